@@ -50,6 +50,13 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, CollapseTransparentHugePages, false, DIAGNOSTIC,        \
+          "With UseTransparentHugePages, synchronously collapse newly " \
+          "committed large-page aligned ranges into huge pages with "   \
+          "MADV_COLLAPSE instead of waiting for khugepaged. This "      \
+          "fills the committed memory eagerly: the huge pages are "     \
+          "allocated and zeroed at commit time")                        \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -77,7 +84,12 @@
           "Use CPU_ALLOC code path in os::active_processor_count ")     \
                                                                         \
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
-          "Write map file for Linux perf tool at exit")
+          "Write map file for Linux perf tool at exit")                 \
+                                                                        \
+  product(bool, DumpPerfMapOnCompilation, false, DIAGNOSTIC,            \
+          "Append an entry to the map file for Linux perf tool each "   \
+          "time a method is compiled or a runtime stub or adapter is "  \
+          "generated. Entries are written in batches and at exit")
 
 // end of RUNTIME_OS_FLAGS
 
@@ -2680,11 +2680,32 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE 25
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
   if (err == 0) {
     realign_memory(addr, size, alignment_hint);
+    if (CollapseTransparentHugePages && UseTransparentHugePages &&
+        alignment_hint > (size_t)vm_page_size()) {
+      // Only whole huge pages can be collapsed. This needs Linux 6.1 or
+      // later; on older kernels madvise fails with EINVAL.
+      char* start = align_up(addr, os::large_page_size());
+      char* end = align_down(addr + size, os::large_page_size());
+      if (start < end) {
+        if (::madvise(start, end - start, MADV_COLLAPSE) == 0) {
+          log_trace(pagesize)("Collapsed [" PTR_FORMAT " - " PTR_FORMAT ") into huge pages",
+                              p2i(start), p2i(end));
+        } else {
+          log_debug(pagesize)("Failed to collapse [" PTR_FORMAT " - " PTR_FORMAT ") into huge pages (%s)",
+                              p2i(start), p2i(end), os::strerror(errno));
+        }
+      }
+    }
   }
   return err;
 }
@@ -2720,8 +2741,12 @@ void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // uncommitted at all. We don't do anything in this case to avoid creating a segment with
   // small pages on top of the SHM segment. This method always works for small pages, so we
   // allow that in any case.
+  // The range stays committed, so re-map it without collapsing it into
+  // huge pages again.
   if (alignment_hint <= (size_t)os::vm_page_size() || can_commit_large_page_memory()) {
-    commit_memory(addr, bytes, alignment_hint, !ExecMem);
+    if (os::Linux::commit_memory_impl(addr, bytes, !ExecMem) == 0) {
+      realign_memory(addr, bytes, alignment_hint);
+    }
   }
 }
 
@@ -34,6 +34,7 @@
 #include "c1/c1_ValueStack.hpp"
 #include "code/debugInfoRec.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerThread.hpp"
 #include "compiler/compilerDirectives.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -390,6 +391,8 @@ int Compilation::compile_java_method() {
     PhaseTraceTime timeit(_t_buildIR);
     build_hir();
   }
+  check_arena_limit();
+  CHECK_BAILOUT_(no_frame_size);
   if (BailoutAfterHIR) {
     BAILOUT_("Bailing out because of -XX:+BailoutAfterHIR", no_frame_size);
   }
@@ -401,6 +404,7 @@ int Compilation::compile_java_method() {
     _frame_map = new FrameMap(method(), hir()->number_of_locks(), MAX2(4, hir()->max_stack()));
     emit_lir();
   }
+  check_arena_limit();
   CHECK_BAILOUT_(no_frame_size);
 
   // Dump compilation data to replay it.
@@ -469,6 +473,7 @@ void Compilation::compile_method() {
 
   // compile method
   int frame_size = compile_java_method();
+  check_arena_limit();
 
   // bailout if method couldn't be compiled
   // Note: make sure we mark the method as not compilable!
@@ -643,6 +648,15 @@ void Compilation::bailout(const char* msg) {
   }
 }
 
+// Bail out if the arenas of this compilation have grown beyond CompilerArenaMemoryLimit.
+// Called between phases; compilations without a task are never limited.
+void Compilation::check_arena_limit() {
+  if (CompilerArenaMemoryLimit > 0 && env()->task() != NULL &&
+      CompilerThread::current()->arena_limit_exceeded()) {
+    bailout("hit memory limit while compiling");
+  }
+}
+
 ciKlass* Compilation::cha_exact_type(ciType* type) {
   if (type != NULL && type->is_loaded() && type->is_instance_klass()) {
     ciInstanceKlass* ik = type->as_instance_klass();
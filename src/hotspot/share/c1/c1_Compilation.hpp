@@ -206,6 +206,7 @@ class Compilation: public StackObj {
   // error handling
   void bailout(const char* msg);
   bool bailed_out() const                        { return _bailout_msg != NULL; }
+  void check_arena_limit();
   const char* bailout_msg() const                { return _bailout_msg; }
 
   static int desired_max_code_buffer_size() {
@@ -33,17 +33,24 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/constantPool.hpp"
+#include "oops/cpCache.hpp"
 #include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -160,6 +167,9 @@ ArchiveBuilder::ArchiveBuilder() :
   _ro_src_objs(),
   _src_obj_table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
   _buffered_to_src_table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
+  _ro_byte_arrays(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
+  _num_deduplicated_arrays(0),
+  _deduplicated_bytes(0),
   _total_closed_heap_region_size(0),
   _total_open_heap_region_size(0),
   _estimated_metaspaceobj_bytes(0),
@@ -298,9 +308,39 @@ int ArchiveBuilder::compare_klass_by_name(Klass** a, Klass** b) {
   return a[0]->name()->fast_compare(b[0]->name());
 }
 
+// Array classes are ordered with their bottom class; primitive arrays go first.
+static int load_order_of(Klass* k) {
+  if (k->is_objArray_klass()) {
+    k = ObjArrayKlass::cast(k)->bottom_klass();
+  }
+  if (k->is_instance_klass()) {
+    return SystemDictionaryShared::load_order(InstanceKlass::cast(k));
+  }
+  return -1;
+}
+
+int ArchiveBuilder::compare_klass_by_load_order(Klass** a, Klass** b) {
+  int order_a = load_order_of(a[0]);
+  int order_b = load_order_of(b[0]);
+  if (order_a != order_b) {
+    return (order_a < order_b) ? -1 : 1;
+  }
+  return compare_klass_by_name(a, b);
+}
+
 void ArchiveBuilder::sort_klasses() {
-  log_info(cds)("Sorting classes ... ");
-  _klasses->sort(compare_klass_by_name);
+  if (ArchiveLayoutByLoadOrder && DumpSharedSpaces) {
+    // During -Xshare:dump, classes are loaded by a single thread in the order of
+    // SharedClassListFile, which in turn records the order in which the classes were
+    // loaded by the training run. Copying the classes in this order keeps the metadata
+    // used during start-up (Methods, ConstMethods, ConstantPools, etc) close together,
+    // while the archive contents remain deterministic.
+    log_info(cds)("Sorting classes by load order ... ");
+    _klasses->sort(compare_klass_by_load_order);
+  } else {
+    log_info(cds)("Sorting classes ... ");
+    _klasses->sort(compare_klass_by_name);
+  }
 }
 
 size_t ArchiveBuilder::estimate_archive_size() {
@@ -589,6 +629,10 @@ void ArchiveBuilder::dump_ro_metadata() {
 
   start_dump_space(&_ro_region);
   make_shallow_copies(&_ro_region, &_ro_src_objs);
+  if (_num_deduplicated_arrays > 0) {
+    log_info(cds)("Deduplicated %d read-only arrays (" SIZE_FORMAT " bytes)",
+                  _num_deduplicated_arrays, _deduplicated_bytes);
+  }
 
 #if INCLUDE_CDS_JAVA_HEAP
   if (is_dumping_full_module_graph()) {
@@ -607,6 +651,31 @@ void ArchiveBuilder::make_shallow_copies(DumpRegion *dump_region,
   log_info(cds)("done (%d objects)", src_objs->objs()->length());
 }
 
+unsigned ArchiveBuilder::byte_array_hash(address const& array) {
+  Array<u1>* a = (Array<u1>*)array;
+  unsigned hash = (unsigned)a->length();
+  for (int i = 0; i < a->length(); i++) {
+    hash = 31 * hash + a->at(i);
+  }
+  return hash;
+}
+
+bool ArchiveBuilder::byte_array_equals(address const& a, address const& b) {
+  Array<u1>* x = (Array<u1>*)a;
+  Array<u1>* y = (Array<u1>*)b;
+  return x->length() == y->length() &&
+         memcmp(x->adr_at(0), y->adr_at(0), x->length()) == 0;
+}
+
+// Array<u1> objects in the ro region (annotations, stack maps, etc) contain no pointers and
+// are never modified at run time, so byte-identical arrays can share a single copy. This is
+// common for generated classes that have many identical method bodies.
+bool ArchiveBuilder::should_deduplicate(SourceObjInfo* src_info) const {
+  return DeduplicateReadOnlyArrays && src_info->read_only() &&
+         src_info->msotype() == MetaspaceObj::TypeArrayU1Type &&
+         ((Array<u1>*)src_info->source_addr())->length() > 0;
+}
+
 void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info) {
   MetaspaceClosure::Ref* ref = src_info->ref();
   address src = ref->obj();
@@ -615,6 +684,18 @@ void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* s
   char* oldtop;
   char* newtop;
 
+  bool dedup = should_deduplicate(src_info);
+  if (dedup) {
+    address* existing = _ro_byte_arrays.get(src);
+    if (existing != NULL) {
+      log_trace(cds)("Dedup: " PTR_FORMAT " ==> " PTR_FORMAT " %d", p2i(src), p2i(*existing), bytes);
+      src_info->set_buffered_addr(*existing);
+      _num_deduplicated_arrays ++;
+      _deduplicated_bytes += bytes;
+      return;
+    }
+  }
+
   oldtop = dump_region->top();
   if (ref->msotype() == MetaspaceObj::ClassType) {
     // Save a pointer immediate in front of an InstanceKlass, so
@@ -649,6 +730,15 @@ void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* s
   log_trace(cds)("Copy: " PTR_FORMAT " ==> " PTR_FORMAT " %d", p2i(src), p2i(dest), bytes);
   src_info->set_buffered_addr((address)dest);
 
+  if (dedup) {
+    bool created;
+    _ro_byte_arrays.put_if_absent(src, (address)dest, &created);
+    assert(created, "must be");
+    if (_ro_byte_arrays.maybe_grow()) {
+      log_info(cds, hashtables)("Expanded _ro_byte_arrays table to %d", _ro_byte_arrays.table_size());
+    }
+  }
+
   _alloc_stats.record(ref->msotype(), int(newtop - oldtop), src_info->read_only());
 }
 
@@ -666,9 +756,51 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
+// Relocating the embedded pointers of the copied objects is embarrassingly parallel:
+// each buffered object is written only by the worker that claims it, and the
+// source->buffered lookups are read-only at this point. The buffer layout has already
+// been fixed by make_shallow_copies(), so the result does not depend on the number of
+// workers or on how the objects are claimed.
+class RelocateEmbeddedPointersTask : public WorkerTask {
+  ArchiveBuilder* _builder;
+  ArchiveBuilder::SourceObjList* _src_objs;
+  volatile int _next;
+
+  static const int ChunkSize = 256;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, ArchiveBuilder::SourceObjList* src_objs) :
+    WorkerTask("CDS Relocate Embedded Pointers"), _builder(builder), _src_objs(src_objs), _next(0) {}
+
+  void work(uint worker_id) {
+    int len = _src_objs->objs()->length();
+    while (true) {
+      int start = Atomic::fetch_and_add(&_next, ChunkSize);
+      if (start >= len) {
+        break;
+      }
+      int end = MIN2(start + ChunkSize, len);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder);
+      }
+    }
+  }
+};
+
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != NULL && workers->active_workers() > 1 &&
+      src_objs->objs()->length() >= MIN_OBJS_FOR_PARALLEL_RELOCATION) {
+    log_debug(cds)("Relocating %d objects with %u workers",
+                   src_objs->objs()->length(), workers->active_workers());
+    ArchivePtrMarker::begin_parallel_marking();
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+    ArchivePtrMarker::end_parallel_marking();
+  } else {
+    for (int i = 0; i < src_objs->objs()->length(); i++) {
+      src_objs->relocate(i, this);
+    }
   }
 }
 
@@ -728,6 +860,26 @@ void ArchiveBuilder::relocate_vm_classes() {
   vmClasses::metaspace_pointers_do(&doit);
 }
 
+// Log the archived size of the main metadata owned by ik, so per-class
+// growth of the archive can be tracked by comparing the output of two dumps.
+static void log_klass_size(int index, InstanceKlass* ik) {
+  int klass_bytes = ik->size() * BytesPerWord;
+  int cp_bytes = ik->constants()->size() * BytesPerWord;
+  if (ik->constants()->cache() != NULL) {
+    cp_bytes += ik->constants()->cache()->size() * BytesPerWord;
+  }
+  Array<Method*>* methods = ik->methods();
+  int method_bytes = methods->size() * BytesPerWord;
+  for (int i = 0; i < methods->length(); i++) {
+    Method* m = methods->at(i);
+    method_bytes += (m->size() + m->constMethod()->size()) * BytesPerWord;
+  }
+  ResourceMark rm;
+  log_trace(cds, class)("klasses[%5d] size: %d bytes (klass %d, constants %d, methods %d) %s",
+                        index, klass_bytes + cp_bytes + method_bytes,
+                        klass_bytes, cp_bytes, method_bytes, ik->external_name());
+}
+
 void ArchiveBuilder::make_klasses_shareable() {
   int num_instance_klasses = 0;
   int num_boot_klasses = 0;
@@ -801,6 +953,9 @@ void ArchiveBuilder::make_klasses_shareable() {
                             p2i(to_requested(k)), type, k->external_name(),
                             hidden, unlinked, generated);
     }
+    if (k->is_instance_klass() && log_is_enabled(Trace, cds, class)) {
+      log_klass_size(i, InstanceKlass::cast(k));
+    }
   }
 
   log_info(cds)("Number of classes %d", num_instance_klasses + num_obj_array_klasses + num_type_array_klasses);
@@ -984,6 +1139,10 @@ class ArchiveBuilder::CDSMapLogger : AllStatic {
       SourceObjInfo* src_info = src_objs->at(i);
       address src = src_info->source_addr();
       address dest = src_info->buffered_addr();
+      if (dest < last_obj_end) {
+        // This object shares the copy of an identical array that has already been logged.
+        continue;
+      }
       log_data(last_obj_base, dest, last_obj_base + buffer_to_runtime_delta());
       address runtime_dest = dest + buffer_to_runtime_delta();
       int bytes = src_info->size_in_bytes();
@@ -1211,7 +1370,9 @@ void ArchiveBuilder::write_archive(FileMapInfo* mapinfo,
                       bitmap, bitmap_size_in_bytes);
   }
   CDS_JAVA_HEAP_ONLY(HeapShared::destroy_archived_object_cache());
-  FREE_C_HEAP_ARRAY(char, bitmap);
+  if (bitmap != (char*)ArchivePtrMarker::ptrmap()->map()) {
+    FREE_C_HEAP_ARRAY(char, bitmap);
+  }
 }
 
 void ArchiveBuilder::write_region(FileMapInfo* mapinfo, int region_idx, DumpRegion* dump_region, bool read_only,  bool allow_exec) {
@@ -122,6 +122,8 @@ public:
   };
 
 private:
+  friend class RelocateEmbeddedPointersTask;
+
   class SpecialRefInfo {
     // We have a "special pointer" of the given _type at _field_offset of _src_obj.
     // See MetaspaceClosure::push_special().
@@ -217,6 +219,10 @@ private:
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
 
+  // Hash and compare read-only Array<u1> objects (annotations, stack maps, etc) by their contents
+  static unsigned byte_array_hash(address const& array);
+  static bool byte_array_equals(address const& a, address const& b);
+
   ReservedSpace _shared_rs;
   VirtualSpace _shared_vs;
 
@@ -228,6 +234,11 @@ private:
   SourceObjList _ro_src_objs;                 // objs to put in ro region
   ResizeableResourceHashtable<address, SourceObjInfo, AnyObj::C_HEAP, mtClassShared> _src_obj_table;
   ResizeableResourceHashtable<address, address, AnyObj::C_HEAP, mtClassShared> _buffered_to_src_table;
+  // "source" -> "buffered" for the first copy of each distinct read-only Array<u1>
+  ResizeableResourceHashtable<address, address, AnyObj::C_HEAP, mtClassShared,
+                              byte_array_hash, byte_array_equals> _ro_byte_arrays;
+  int _num_deduplicated_arrays;
+  size_t _deduplicated_bytes;
   GrowableArray<Klass*>* _klasses;
   GrowableArray<Symbol*>* _symbols;
   GrowableArray<SpecialRefInfo>* _special_refs;
@@ -268,11 +279,16 @@ private:
   void sort_klasses();
   static int compare_symbols_by_address(Symbol** a, Symbol** b);
   static int compare_klass_by_name(Klass** a, Klass** b);
+  static int compare_klass_by_load_order(Klass** a, Klass** b);
 
   void make_shallow_copies(DumpRegion *dump_region, const SourceObjList* src_objs);
   void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
+  bool should_deduplicate(SourceObjInfo* src_info) const;
 
   void update_special_refs();
+
+  // Below this many objects, it's not worth waking up the worker threads.
+  static const int MIN_OBJS_FOR_PARALLEL_RELOCATION = 4 * K;
   void relocate_embedded_pointers(SourceObjList* src_objs);
 
   bool is_excluded(Klass* k);
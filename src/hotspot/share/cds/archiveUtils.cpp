@@ -48,6 +48,7 @@ CHeapBitMap* ArchivePtrMarker::_ptrmap = NULL;
 VirtualSpace* ArchivePtrMarker::_vs;
 
 bool ArchivePtrMarker::_compacted;
+bool ArchivePtrMarker::_is_marking_in_parallel = false;
 
 void ArchivePtrMarker::initialize(CHeapBitMap* ptrmap, VirtualSpace* vs) {
   assert(_ptrmap == NULL, "initialize only once");
@@ -81,6 +82,11 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
     if (value != NULL) {
       assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
       size_t idx = ptr_loc - ptr_base();
+      if (_is_marking_in_parallel) {
+        assert(idx < _ptrmap->size(), "bitmap must have been expanded by begin_parallel_marking()");
+        _ptrmap->par_set_bit(idx);
+        return;
+      }
       if (_ptrmap->size() <= idx) {
         _ptrmap->resize((idx + 1) * 2);
       }
@@ -91,6 +97,23 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+void ArchivePtrMarker::begin_parallel_marking() {
+  assert(!_compacted, "cannot mark anymore");
+  assert(!_is_marking_in_parallel, "must not be nested");
+  // Make sure every pointer location in the committed space has a bit, so the
+  // bitmap is not resized while other threads are setting bits.
+  size_t needed = ptr_end() - ptr_base();
+  if (_ptrmap->size() < needed) {
+    _ptrmap->resize(needed);
+  }
+  _is_marking_in_parallel = true;
+}
+
+void ArchivePtrMarker::end_parallel_marking() {
+  assert(_is_marking_in_parallel, "must be");
+  _is_marking_in_parallel = false;
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != NULL, "not initialized");
   assert(!_compacted, "cannot clear anymore");
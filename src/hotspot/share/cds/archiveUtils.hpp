@@ -48,6 +48,10 @@ class ArchivePtrMarker : AllStatic {
   // avoid unintentional copy operations after the bitmap has been finalized and written.
   static bool         _compacted;
 
+  // While this is true, mark_pointer() may be called by multiple threads. The
+  // bitmap has been sized to cover the committed range and is never resized.
+  static bool         _is_marking_in_parallel;
+
   static address* ptr_base() { return (address*)_vs->low();  } // committed lower bound (inclusive)
   static address* ptr_end()  { return (address*)_vs->high(); } // committed upper bound (exclusive)
 
@@ -58,6 +62,10 @@ public:
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
+  // Called before and after mark_pointer() is used by multiple worker threads.
+  static void begin_parallel_marking();
+  static void end_parallel_marking();
+
   template <typename T>
   static void mark_pointer(T* ptr_loc) {
     mark_pointer((address*)ptr_loc);
@@ -108,6 +116,18 @@ class SharedDataRelocator: public BitMapClosure {
   // How much to relocate for each pointer.
   intx _delta;
 
+  // Statistics: the number of patched pointers, and the number of distinct pages
+  // that had to be written (and thus copied-on-write from the mapped archive file).
+  // Only collected by patch() when -Xlog:cds+reloc=info is enabled.
+  size_t _patched_pointers;
+  size_t _patched_pages;
+  uintptr_t _last_patched_page;
+  int _page_shift;
+
+  inline address* relocate(size_t offset);
+  inline void count_patched(address* first, address* last);
+  template <bool COLLECT_STATS> void patch_impl(const BitMap& ptrmap);
+
  public:
   SharedDataRelocator(address* patch_base, address* patch_end,
                       address valid_old_base, address valid_old_end,
@@ -115,7 +135,7 @@ class SharedDataRelocator: public BitMapClosure {
     _patch_base(patch_base), _patch_end(patch_end),
     _valid_old_base(valid_old_base), _valid_old_end(valid_old_end),
     _valid_new_base(valid_new_base), _valid_new_end(valid_new_end),
-    _delta(delta) {
+    _delta(delta), _patched_pointers(0), _patched_pages(0), _last_patched_page(0), _page_shift(0) {
     log_debug(cds, reloc)("SharedDataRelocator::_patch_base     = " PTR_FORMAT, p2i(_patch_base));
     log_debug(cds, reloc)("SharedDataRelocator::_patch_end      = " PTR_FORMAT, p2i(_patch_end));
     log_debug(cds, reloc)("SharedDataRelocator::_valid_old_base = " PTR_FORMAT, p2i(_valid_old_base));
@@ -125,6 +145,15 @@ class SharedDataRelocator: public BitMapClosure {
   }
 
   bool do_bit(size_t offset);
+
+  // Patch all pointers marked in ptrmap. This has the same effect as ptrmap.iterate(this),
+  // but scans the bitmap a word at a time, and patches fully marked words (runs of
+  // BitsPerWord consecutive pointers, such as vtables and Array<Method*>) in a simple
+  // loop that the C++ compiler can vectorize.
+  void patch(const BitMap& ptrmap);
+
+  size_t patched_pointers() const { return _patched_pointers; }
+  size_t patched_pages()    const { return _patched_pages; }
 };
 
 class DumpRegion {
@@ -27,9 +27,12 @@
 
 #include "cds/archiveUtils.hpp"
 
+#include "runtime/os.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/count_trailing_zeros.hpp"
+#include "utilities/powerOfTwo.hpp"
 
-inline bool SharedDataRelocator::do_bit(size_t offset) {
+inline address* SharedDataRelocator::relocate(size_t offset) {
   address* p = _patch_base + offset;
   assert(_patch_base <= p && p < _patch_end, "must be");
 
@@ -44,7 +47,74 @@ inline bool SharedDataRelocator::do_bit(size_t offset) {
   DEBUG_ONLY(log_trace(cds, reloc)("Patch2: @%8d [" PTR_FORMAT "] " PTR_FORMAT " -> " PTR_FORMAT,
                                    (int)offset, p2i(p), p2i(old_ptr), p2i(new_ptr)));
   *p = new_ptr;
+  return p;
+}
+
+// Account for the patched pointers in [first, last]. The bitmap is processed in
+// increasing address order, so each page is counted once.
+inline void SharedDataRelocator::count_patched(address* first, address* last) {
+  uintptr_t first_page = uintptr_t(first) >> _page_shift;
+  uintptr_t last_page  = uintptr_t(last) >> _page_shift;
+  _patched_pages += (last_page - first_page + 1) - (first_page == _last_patched_page ? 1 : 0);
+  _last_patched_page = last_page;
+  _patched_pointers += (last - first) + 1;
+}
+
+inline bool SharedDataRelocator::do_bit(size_t offset) {
+  relocate(offset);
   return true; // keep iterating
 }
 
+template <bool COLLECT_STATS>
+inline void SharedDataRelocator::patch_impl(const BitMap& ptrmap) {
+  const BitMap::bm_word_t* words = ptrmap.map();
+  const size_t size_in_words = ptrmap.size_in_words();
+  const size_t tail_bits = ptrmap.size() % BitsPerWord;
+
+  for (size_t w = 0; w < size_in_words; w++) {
+    BitMap::bm_word_t word = words[w];
+    if (w == size_in_words - 1 && tail_bits != 0) {
+      word &= right_n_bits(tail_bits);
+    }
+    if (word == 0) {
+      continue;
+    }
+
+    const size_t first_offset = w * BitsPerWord;
+    if (word == ~BitMap::bm_word_t(0)) {
+      uintptr_t* p = (uintptr_t*)(_patch_base + first_offset);
+      assert((address*)p + BitsPerWord <= _patch_end, "must be");
+#ifdef ASSERT
+      for (int i = 0; i < BitsPerWord; i++) {
+        address old_ptr = (address)p[i];
+        assert(_valid_old_base <= old_ptr && old_ptr < _valid_old_end, "must be");
+      }
+#endif
+      for (int i = 0; i < BitsPerWord; i++) {
+        p[i] += (uintptr_t)_delta;
+      }
+      if (COLLECT_STATS) {
+        count_patched((address*)p, (address*)p + BitsPerWord - 1);
+      }
+    } else {
+      do {
+        address* p = relocate(first_offset + count_trailing_zeros(word));
+        if (COLLECT_STATS) {
+          count_patched(p, p);
+        }
+        word &= word - 1; // clear the lowest set bit
+      } while (word != 0);
+    }
+  }
+}
+
+inline void SharedDataRelocator::patch(const BitMap& ptrmap) {
+  if (log_is_enabled(Info, cds, reloc)) {
+    _page_shift = log2i_exact((uintptr_t)os::vm_page_size());
+    patch_impl<true>(ptrmap);
+  } else {
+    patch_impl<false>(ptrmap);
+  }
+}
+
 #endif // SHARE_CDS_ARCHIVEUTILS_INLINE_HPP
@@ -88,6 +88,26 @@
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
+  product(bool, ArchiveFieldReferences, false, DIAGNOSTIC,                  \
+          "Archive resolved JVM_CONSTANT_Fieldref in ConstantPoolCache")    \
+                                                                            \
+  product(bool, ArchiveMethodReferences, false, DIAGNOSTIC,                 \
+          "Archive resolved JVM_CONSTANT_Methodref in ConstantPoolCache")   \
+                                                                            \
+  product(bool, ArchiveLayoutByLoadOrder, false, DIAGNOSTIC,                \
+          "When creating the static archive, copy classes and their "       \
+          "metadata in the order they were loaded (e.g., the order of "     \
+          "SharedClassListFile) instead of sorting them by name")           \
+                                                                            \
+  product(bool, ArchiveRegionsInLargePages, false, DIAGNOSTIC,              \
+          "Read the rw and ro regions of the CDS archive into memory "      \
+          "backed by transparent huge pages, instead of mapping the "       \
+          "archive file. Requires -XX:+UseTransparentHugePages")            \
+                                                                            \
+  product(bool, DeduplicateReadOnlyArrays, false, DIAGNOSTIC,               \
+          "Store only one copy of byte-identical read-only arrays (such "   \
+          "as annotations and stack maps) in the CDS archive")              \
+                                                                            \
   product(int, ArchiveRelocationMode, 0, DIAGNOSTIC,                        \
            "(0) first map at preferred address, and if "                    \
            "unsuccessful, map at alternative address (default); "           \
@@ -27,8 +27,11 @@
 #include "cds/classPrelinker.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
+#include "interpreter/bytecodeStream.hpp"
+#include "interpreter/interpreterRuntime.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/constantPool.inline.hpp"
+#include "oops/cpCache.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -113,6 +116,89 @@ bool ClassPrelinker::can_archive_resolved_klass(InstanceKlass* cp_holder, Klass*
   return false;
 }
 
+bool ClassPrelinker::is_builtin_class(InstanceKlass* ik) {
+  return ik->is_shared_boot_class() || ik->is_shared_platform_class() || ik->is_shared_app_class();
+}
+
+// No loader constraints are checked when an archived entry is used at run time, so
+// we only archive references where the constraints are trivially satisfied.
+bool ClassPrelinker::is_same_loader(InstanceKlass* cp_holder, Klass* holder) {
+  return cp_holder->class_loader() == holder->class_loader();
+}
+
+bool ClassPrelinker::can_archive_resolved_cp_cache_entry(ConstantPoolCache* cpcache, int cpcache_index) {
+  assert(!is_in_archivebuilder_buffer(cpcache), "sanity");
+
+  ConstantPoolCacheEntry* entry = cpcache->entry_at(cpcache_index);
+  Bytecodes::Code b1 = entry->bytecode_1();
+  Bytecodes::Code b2 = entry->bytecode_2();
+  if (b1 == 0 && b2 == 0) {
+    return false; // not resolved
+  }
+
+  ConstantPool* cp = cpcache->constant_pool();
+  InstanceKlass* cp_holder = cp->pool_holder();
+  if (!is_builtin_class(cp_holder) || cp_holder->is_hidden()) {
+    return false;
+  }
+
+  int cp_index = entry->constant_pool_index();
+  if (!cp->tag_at(cp_index).is_field_or_method()) {
+    // invokedynamic call sites are not archived.
+    return false;
+  }
+  int klass_cp_index = cp->uncached_klass_ref_index_at(cp_index);
+  if (!cp->tag_at(klass_cp_index).is_klass() ||
+      !can_archive_resolved_klass(cp, klass_cp_index)) {
+    // The symbolic reference may resolve to a different class at run time.
+    return false;
+  }
+
+  if (entry->is_field_entry()) {
+    if (!ArchiveFieldReferences || !cp->tag_at(cp_index).is_field()) {
+      return false;
+    }
+    // getstatic/putstatic must go through the class initialization barrier.
+    if (b1 != Bytecodes::_getfield || (b2 != 0 && b2 != Bytecodes::_putfield)) {
+      return false;
+    }
+    return is_same_loader(cp_holder, entry->f1_as_klass());
+  } else {
+    if (!ArchiveMethodReferences || !cp->tag_at(cp_index).is_method()) {
+      return false;
+    }
+    // Only invokespecial and invokevirtual are supported. invokestatic depends on
+    // class initialization, and invokehandle sites have an appendix in the
+    // resolved_references array.
+    if ((b1 != 0 && b1 != Bytecodes::_invokespecial) ||
+        (b2 != 0 && b2 != Bytecodes::_invokevirtual) ||
+        entry->has_appendix() || entry->is_forced_virtual()) {
+      return false;
+    }
+    if (b1 == Bytecodes::_invokespecial) {
+      if (!is_same_loader(cp_holder, entry->f1_as_method()->method_holder())) {
+        return false;
+      }
+    } else if (entry->f1_ord() != NULL) {
+      // An invokespecial in an interface that was linked but not marked as
+      // resolved. It must be re-resolved at run time.
+      return false;
+    }
+    if (b2 == Bytecodes::_invokevirtual) {
+      if (entry->is_vfinal()) {
+        if (!is_same_loader(cp_holder, entry->f2_as_vfinal_method()->method_holder())) {
+          return false;
+        }
+      } else if (!cp_holder->is_shared_boot_class()) {
+        // The resolved method remembered only by its vtable index may be declared by a
+        // class in a parent loader. Only the boot loader is known to have no parent.
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
 void ClassPrelinker::dumptime_resolve_constants(InstanceKlass* ik, TRAPS) {
   constantPoolHandle cp(THREAD, ik->constants());
   if (cp->cache() == NULL || cp->reference_map() == NULL) {
@@ -139,6 +225,86 @@ void ClassPrelinker::dumptime_resolve_constants(InstanceKlass* ik, TRAPS) {
       break;
     }
   }
+
+  if (ArchiveFieldReferences || ArchiveMethodReferences) {
+    preresolve_field_and_method_cp_entries(THREAD, ik);
+  }
+}
+
+// Resolve the cpCache entries of the field/method references that are used by the
+// getfield/putfield/invokevirtual/invokespecial bytecodes of ik, so that they can be
+// stored in the archive (see can_archive_resolved_cp_cache_entry()). Resolution
+// errors are ignored -- the entries will be resolved again at run time, and the
+// error will be thrown at the expected place.
+void ClassPrelinker::preresolve_field_and_method_cp_entries(JavaThread* current, InstanceKlass* ik) {
+  constantPoolHandle cp(current, ik->constants());
+  if (!is_builtin_class(ik) || ik->is_hidden()) {
+    return;
+  }
+
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    Method* m = methods->at(i);
+    BytecodeStream bcs(methodHandle(current, m));
+    while (bcs.next() >= 0) {
+      Bytecodes::Code raw_bc = bcs.raw_code();
+      switch (raw_bc) {
+      case Bytecodes::_getfield:
+      case Bytecodes::_nofast_getfield:
+      case Bytecodes::_putfield:
+      case Bytecodes::_nofast_putfield:
+        if (!ArchiveFieldReferences) {
+          break;
+        }
+        maybe_resolve_field_or_method(cp, m, Bytecodes::java_code(raw_bc), bcs.get_index_u2_cpcache(), current);
+        if (current->has_pending_exception()) {
+          current->clear_pending_exception();
+        }
+        break;
+      case Bytecodes::_invokevirtual: // not _invokehandle
+      case Bytecodes::_invokespecial:
+        if (!ArchiveMethodReferences) {
+          break;
+        }
+        maybe_resolve_field_or_method(cp, m, raw_bc, bcs.get_index_u2_cpcache(), current);
+        if (current->has_pending_exception()) {
+          current->clear_pending_exception();
+        }
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+void ClassPrelinker::maybe_resolve_field_or_method(constantPoolHandle cp, Method* m, Bytecodes::Code bc,
+                                                   int raw_index, TRAPS) {
+  ConstantPoolCacheEntry* entry = cp->cache()->entry_at(ConstantPool::decode_cpcache_index(raw_index));
+  if (entry->is_resolved(bc)) {
+    return;
+  }
+
+  int klass_cp_index = cp->uncached_klass_ref_index_at(entry->constant_pool_index());
+  if (!cp->tag_at(klass_cp_index).is_klass() || !can_archive_resolved_klass(cp(), klass_cp_index)) {
+    // Do not load any classes here, and skip references whose result cannot be archived.
+    return;
+  }
+
+  HandleMark hm(THREAD);
+  methodHandle mh(THREAD, m);
+  switch (bc) {
+  case Bytecodes::_getfield:
+  case Bytecodes::_putfield:
+    InterpreterRuntime::resolve_get_put(bc, raw_index, mh, cp, CHECK);
+    break;
+  case Bytecodes::_invokevirtual:
+  case Bytecodes::_invokespecial:
+    InterpreterRuntime::cds_resolve_invoke(bc, raw_index, cp, CHECK);
+    break;
+  default:
+    ShouldNotReachHere();
+  }
 }
 
 Klass* ClassPrelinker::find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name) {
@@ -25,6 +25,7 @@
 #ifndef SHARE_CDS_CLASSPRELINKER_HPP
 #define SHARE_CDS_CLASSPRELINKER_HPP
 
+#include "interpreter/bytecodes.hpp"
 #include "oops/oopsHierarchy.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/allocation.hpp"
@@ -34,9 +35,11 @@
 #include "utilities/resourceHash.hpp"
 
 class ConstantPool;
+class ConstantPoolCache;
 class constantPoolHandle;
 class InstanceKlass;
 class Klass;
+class Method;
 
 // ClassPrelinker is used to perform ahead-of-time linking of ConstantPool entries
 // for archived InstanceKlasses.
@@ -67,6 +70,12 @@ class ClassPrelinker :  AllStatic {
   static Klass* maybe_resolve_class(constantPoolHandle cp, int cp_index, TRAPS);
   static bool can_archive_resolved_klass(InstanceKlass* cp_holder, Klass* resolved_klass);
   static Klass* find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name);
+  static bool is_builtin_class(InstanceKlass* ik);
+
+  static void preresolve_field_and_method_cp_entries(JavaThread* current, InstanceKlass* ik);
+  static void maybe_resolve_field_or_method(constantPoolHandle cp, Method* m, Bytecodes::Code bc,
+                                            int raw_index, TRAPS);
+  static bool is_same_loader(InstanceKlass* cp_holder, Klass* holder);
 
 public:
   static void initialize();
@@ -86,6 +95,13 @@ public:
   // the result in the CDS archive? Returns true if cp_index is guaranteed to
   // resolve to the same InstanceKlass* at both dump time and run time.
   static bool can_archive_resolved_klass(ConstantPool* cp, int cp_index);
+
+  // Can the resolved field or method entry at cpcache_index in this cpCache be
+  // stored in the CDS archive? Returns true only if the entry is guaranteed to
+  // resolve to the same field holder or Method* at both dump time and run time,
+  // and no runtime checks (class initialization, receiver checks, loader
+  // constraints) are skipped by using the archived entry.
+  static bool can_archive_resolved_cp_cache_entry(ConstantPoolCache* cpcache, int cpcache_index);
 };
 
 #endif // SHARE_CDS_CLASSPRELINKER_HPP
@@ -105,5 +105,11 @@ void DumpAllocStats::print_stats(int ro_all, int rw_all) {
   msg.debug("Class CP entries = %d, archived = %d (%3.1f%%)",
             _num_klass_cp_entries, _num_klass_cp_entries_archived,
             percent_of(_num_klass_cp_entries_archived, _num_klass_cp_entries));
+  msg.debug("Field CP entries = %d, archived = %d (%3.1f%%)",
+            _num_field_cp_entries, _num_field_cp_entries_archived,
+            percent_of(_num_field_cp_entries_archived, _num_field_cp_entries));
+  msg.debug("Method CP entries = %d, archived = %d (%3.1f%%)",
+            _num_method_cp_entries, _num_method_cp_entries_archived,
+            percent_of(_num_method_cp_entries_archived, _num_method_cp_entries));
 
 }
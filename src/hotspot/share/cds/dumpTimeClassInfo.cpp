@@ -42,6 +42,7 @@ DumpTimeClassInfo::DumpTimeClassInfo(const DumpTimeClassInfo& src) {
   _is_archived_lambda_proxy = src._is_archived_lambda_proxy;
   _has_checked_exclusion = src._has_checked_exclusion;
   _id = src._id;
+  _load_order = src._load_order;
   _clsfile_size = src._clsfile_size;
   _clsfile_crc32 = src._clsfile_crc32;
   _excluded = src._excluded;
@@ -193,6 +194,7 @@ DumpTimeClassInfo* DumpTimeSharedClassTable::allocate_info(InstanceKlass* k) {
   DumpTimeClassInfo* p = put_if_absent(k, &created);
   assert(created, "must not exist in table");
   p->_klass = k;
+  p->_load_order = _num_allocated++;
   return p;
 }
 
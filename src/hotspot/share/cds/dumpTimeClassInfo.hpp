@@ -122,6 +122,7 @@ public:
   bool                         _failed_verification;
   bool                         _is_archived_lambda_proxy;
   int                          _id;
+  int                          _load_order;
   int                          _clsfile_size;
   int                          _clsfile_crc32;
   GrowableArray<DTVerifierConstraint>* _verifier_constraints;
@@ -136,6 +137,7 @@ public:
     _is_archived_lambda_proxy = false;
     _has_checked_exclusion = false;
     _id = -1;
+    _load_order = -1;
     _clsfile_size = -1;
     _clsfile_crc32 = -1;
     _excluded = false;
@@ -204,6 +206,11 @@ public:
     return _is_early_klass;
   }
 
+  // Position of this class in the sequence of classes registered in the DumpTimeSharedClassTable
+  int load_order() const {
+    return _load_order;
+  }
+
   // simple accessors
   void set_excluded()                               { _excluded = true; }
   bool has_checked_exclusion() const                { return _has_checked_exclusion; }
@@ -241,10 +248,12 @@ class DumpTimeSharedClassTable: public DumpTimeSharedClassTableBaseType
 {
   int _builtin_count;
   int _unregistered_count;
+  int _num_allocated;
 public:
   DumpTimeSharedClassTable() {
     _builtin_count = 0;
     _unregistered_count = 0;
+    _num_allocated = 0;
   }
   DumpTimeClassInfo* allocate_info(InstanceKlass* k);
   DumpTimeClassInfo* get_info(InstanceKlass* k);
@@ -60,6 +60,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timerTrace.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
@@ -1401,7 +1402,11 @@ bool FileMapInfo::init_from_file(int fd) {
 
   if (_is_static) {
     if (gen_header->_magic != CDS_ARCHIVE_MAGIC) {
-      FileMapInfo::fail_continue("Not a base shared archive: %s", _full_path);
+      if (gen_header->_magic == CDS_DYNAMIC_ARCHIVE_MAGIC) {
+        FileMapInfo::fail_continue("Not a base shared archive: %s (a dynamic archive cannot be used as the base of another dynamic archive)", _full_path);
+      } else {
+        FileMapInfo::fail_continue("Not a base shared archive: %s", _full_path);
+      }
       return false;
     }
   } else {
@@ -1687,20 +1692,24 @@ char* FileMapInfo::write_bitmap_region(const CHeapBitMap* ptrmap,
                                        size_t &size_in_bytes) {
   size_t size_in_bits = ptrmap->size();
   size_in_bytes = ptrmap->size_in_bytes();
+  header()->set_ptrmap_size_in_bits(size_in_bits);
 
-  if (closed_bitmaps != NULL && open_bitmaps != NULL) {
-    size_in_bytes = set_bitmaps_offset(closed_bitmaps, size_in_bytes);
-    size_in_bytes = set_bitmaps_offset(open_bitmaps, size_in_bytes);
+  if (closed_bitmaps == NULL || open_bitmaps == NULL) {
+    // Only the relocation bitmap is written (e.g., for the dynamic archive). Write it directly
+    // from ptrmap, instead of making a copy of it while the whole dump buffer is still alive.
+    char* buffer = (char*)ptrmap->map();
+    write_region(MetaspaceShared::bm, buffer, size_in_bytes, /*read_only=*/true, /*allow_exec=*/false);
+    return buffer;
   }
 
+  size_in_bytes = set_bitmaps_offset(closed_bitmaps, size_in_bytes);
+  size_in_bytes = set_bitmaps_offset(open_bitmaps, size_in_bytes);
+
   char* buffer = NEW_C_HEAP_ARRAY(char, size_in_bytes, mtClassShared);
   ptrmap->write_to((BitMap::bm_word_t*)buffer, ptrmap->size_in_bytes());
-  header()->set_ptrmap_size_in_bits(size_in_bits);
 
-  if (closed_bitmaps != NULL && open_bitmaps != NULL) {
-    size_t curr_offset = write_bitmaps(closed_bitmaps, ptrmap->size_in_bytes(), buffer);
-    write_bitmaps(open_bitmaps, curr_offset, buffer);
-  }
+  size_t curr_offset = write_bitmaps(closed_bitmaps, ptrmap->size_in_bytes(), buffer);
+  write_bitmaps(open_bitmaps, curr_offset, buffer);
 
   write_region(MetaspaceShared::bm, (char*)buffer, size_in_bytes, /*read_only=*/true, /*allow_exec=*/false);
   return buffer;
@@ -1957,6 +1966,22 @@ MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_ba
                     shared_region_name[i], p2i(requested_addr));
       return MAP_ARCHIVE_OTHER_FAILURE; // oom or I/O error.
     }
+  } else if (ArchiveRegionsInLargePages && LINUX_ONLY(UseTransparentHugePages) NOT_LINUX(false) && rs.is_reserved()) {
+    // A private file mapping cannot be backed by transparent huge pages. Instead,
+    // commit anonymous memory in the reserved space, advise the OS to back it with
+    // huge pages, and read the region into it. This costs a copy at start-up, but
+    // reduces TLB misses when the archived metadata is traversed later on.
+    r->set_read_only(false);
+    if (!os::commit_memory(requested_addr, size, os::large_page_size(), r->allow_exec())) {
+      log_info(cds)("Failed to commit %s shared space at " INTPTR_FORMAT,
+                    shared_region_name[i], p2i(requested_addr));
+      return MAP_ARCHIVE_OTHER_FAILURE;
+    }
+    if (!read_region(i, requested_addr, size, /* do_commit = */ false)) {
+      log_info(cds)("Failed to read %s shared space into reserved space at " INTPTR_FORMAT,
+                    shared_region_name[i], p2i(requested_addr));
+      return MAP_ARCHIVE_OTHER_FAILURE; // I/O error.
+    }
   } else {
     // Note that this may either be a "fresh" mapping into unreserved address
     // space (Windows, first mapping attempt), or a mapping into pre-reserved
@@ -2043,12 +2068,26 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
     address valid_new_base = (address)header()->mapped_base_address();
     address valid_new_end  = (address)mapped_end();
 
+    // All pointers are patched eagerly: archived metadata is accessed directly through
+    // its embedded pointers (e.g., InstanceKlass::_super, Method::_constMethod) from all
+    // over the VM, so we cannot defer patching until a class is looked up. Only the pages
+    // that contain marked pointers are written, the rest of the mapping stays backed by
+    // the archive file.
+    jlong start = os::javaTimeNanos();
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    patcher.patch(ptrmap);
+    jlong elapsed = os::javaTimeNanos() - start;
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
+    if (log_is_enabled(Info, cds, reloc)) {
+      size_t total_pages = (patch_end - patch_base) / os::vm_page_size();
+      log_info(cds, reloc)("Patched " SIZE_FORMAT " pointers in " SIZE_FORMAT " of " SIZE_FORMAT
+                           " pages (%.1f%%) in " JLONG_FORMAT " us",
+                           patcher.patched_pointers(), patcher.patched_pages(), total_pages,
+                           percent_of(patcher.patched_pages(), total_pages), elapsed / 1000);
+    }
     log_debug(cds, reloc)("runtime archive relocation done");
     return true;
   }
@@ -2125,6 +2164,7 @@ MemRegion FileMapInfo::get_heap_regions_requested_range() {
 }
 
 void FileMapInfo::map_or_load_heap_regions() {
+  TraceTime timer("Map or load archived heap regions", TRACETIME_LOG(Info, startuptime));
   bool success = false;
 
   if (can_use_heap_regions()) {
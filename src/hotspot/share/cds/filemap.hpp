@@ -450,6 +450,7 @@ public:
   void  write_header();
   void  write_region(int region, char* base, size_t size,
                      bool read_only, bool allow_exec);
+  // The returned buffer must be freed by the caller, unless it is ptrmap->map().
   char* write_bitmap_region(const CHeapBitMap* ptrmap,
                             GrowableArray<ArchiveHeapBitmapInfo>* closed_bitmaps,
                             GrowableArray<ArchiveHeapBitmapInfo>* open_bitmaps,
@@ -56,6 +56,7 @@
 #include "runtime/init.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timerTrace.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
 #if INCLUDE_G1GC
@@ -100,6 +101,13 @@ static const ArchivedKlassSubGraphInfoRecord* _test_class_record = NULL;
 //
 // If you add new entries to the following tables, you should know what you're doing!
 //
+// All entries must be static fields of boot classes in java.base. At runtime, an archived
+// subgraph is installed only when the holder's <clinit> explicitly asks for it by calling
+// jdk.internal.misc.CDS.initializeFromArchive(), which is not accessible to application
+// classes. Also, application classes are loaded only after the module graph and the
+// builtin class loaders have been set up, so an archived subgraph cannot safely refer to
+// them (see KlassSubGraphInfo::check_allowed_klass()).
+//
 
 // Entry fields for shareable subgraphs archived in the closed archive heap
 // region. Warning: Objects in the subgraphs should not have reference fields
@@ -911,6 +919,7 @@ void HeapShared::resolve_classes(JavaThread* current) {
   if (!ArchiveHeapLoader::is_fully_available()) {
     return; // nothing to do
   }
+  TraceTime timer("Resolve classes of archived subgraphs", TRACETIME_LOG(Info, startuptime));
   resolve_classes_for_subgraphs(current, closed_archive_subgraph_entry_fields);
   resolve_classes_for_subgraphs(current, open_archive_subgraph_entry_fields);
   resolve_classes_for_subgraphs(current, fmg_open_archive_subgraph_entry_fields);
@@ -73,6 +73,7 @@
 #include "runtime/os.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/memTracker.hpp"
@@ -647,6 +648,8 @@ void MetaspaceShared::link_shared_classes(bool jcmd_request, TRAPS) {
     LambdaFormInvokers::regenerate_holder_classes(CHECK);
   }
 
+  TraceTime timer("Linking shared classes", TRACETIME_LOG(Info, cds));
+
   // Collect all loaded ClassLoaderData.
   CollectCLDClosure collect_cld(THREAD);
   {
@@ -772,6 +775,10 @@ void MetaspaceShared::preload_classes(TRAPS) {
   }
 
   log_info(cds)("Loading classes to share ...");
+  // Classes are loaded by a single thread, in the order of the classlist. This is
+  // required for producing deterministic archives (see comments in
+  // ArchiveBuilder::gather_klasses_and_symbols()), so we cannot load them in parallel.
+  TraceTime timer("Loading classes to share", TRACETIME_LOG(Info, cds));
   _has_error_classes = false;
   int class_count = ClassListParser::parse_classlist(classlist_path,
                                                      ClassListParser::_parse_all, CHECK);
@@ -967,6 +974,7 @@ bool MetaspaceShared::is_shared_dynamic(void* p) {
 
 void MetaspaceShared::initialize_runtime_shared_and_meta_spaces() {
   assert(UseSharedSpaces, "Must be called when UseSharedSpaces is enabled");
+  TraceTime timer("Map CDS archives", TRACETIME_LOG(Info, startuptime));
   MapArchiveResult result = MAP_ARCHIVE_OTHER_FAILURE;
 
   FileMapInfo* static_mapinfo = open_static_archive();
@@ -1478,6 +1486,7 @@ class CountSharedSymbols : public SymbolClosure {
 // serialize it out to its various destinations.
 
 void MetaspaceShared::initialize_shared_spaces() {
+  TraceTime timer("Initialize shared spaces", TRACETIME_LOG(Info, startuptime));
   FileMapInfo *static_mapinfo = FileMapInfo::current_info();
 
   // Verify various attributes of the archive, plus initialize the
@@ -252,6 +252,11 @@ bool SystemDictionaryShared::is_early_klass(InstanceKlass* ik) {
   return (info != NULL) ? info->is_early_klass() : false;
 }
 
+int SystemDictionaryShared::load_order(InstanceKlass* ik) {
+  DumpTimeClassInfo* info = _dumptime_table->get(ik);
+  return (info != NULL) ? info->load_order() : -1;
+}
+
 bool SystemDictionaryShared::is_hidden_lambda_proxy(InstanceKlass* ik) {
   assert(ik->is_shared(), "applicable to only a shared class");
   if (ik->is_hidden()) {
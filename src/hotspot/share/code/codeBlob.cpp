@@ -197,6 +197,7 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
 
   if (stub != NULL && (PrintStubCode ||
                        Forte::is_enabled() ||
+                       LINUX_ONLY(DumpPerfMapOnCompilation ||)
                        JvmtiExport::should_post_dynamic_code_generated())) {
     char stub_id[256];
     assert(strlen(name1) + strlen(name2) < sizeof(stub_id), "");
@@ -217,6 +218,11 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
     if (Forte::is_enabled()) {
       Forte::register_stub(stub_id, stub->code_begin(), stub->code_end());
     }
+#ifdef LINUX
+    if (DumpPerfMapOnCompilation) {
+      CodeCache::write_perf_map_entry(stub_id, stub->code_begin(), stub->code_end());
+    }
+#endif
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       const char* stub_name = name2;
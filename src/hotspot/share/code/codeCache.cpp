@@ -1822,12 +1822,26 @@ void CodeCache::log_state(outputStream* st) {
 }
 
 #ifdef LINUX
+// Perf expects to find the map file at /tmp/perf-<pid>.map.
+static void perf_map_file_name(char* fname, size_t len) {
+  jio_snprintf(fname, len, "/tmp/perf-%d.map", os::current_process_id());
+}
+
+static void print_perf_map_entry(outputStream* st, CodeBlob* cb) {
+  ResourceMark rm;
+  const char* method_name =
+    cb->is_compiled() ? cb->as_compiled_method()->method()->external_name()
+                      : cb->name();
+  st->print_cr(INTPTR_FORMAT " " INTPTR_FORMAT " %s",
+               (intptr_t)cb->code_begin(), (intptr_t)cb->code_size(),
+               method_name);
+}
+
 void CodeCache::write_perf_map() {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
-  // Perf expects to find the map file at /tmp/perf-<pid>.map.
   char fname[32];
-  jio_snprintf(fname, sizeof(fname), "/tmp/perf-%d.map", os::current_process_id());
+  perf_map_file_name(fname, sizeof(fname));
 
   fileStream fs(fname, "w");
   if (!fs.is_open()) {
@@ -1837,15 +1851,73 @@ void CodeCache::write_perf_map() {
 
   AllCodeBlobsIterator iter(AllCodeBlobsIterator::only_not_unloading);
   while (iter.next()) {
-    CodeBlob *cb = iter.method();
-    ResourceMark rm;
-    const char* method_name =
-      cb->is_compiled() ? cb->as_compiled_method()->method()->external_name()
-                        : cb->name();
-    fs.print_cr(INTPTR_FORMAT " " INTPTR_FORMAT " %s",
-                (intptr_t)cb->code_begin(), (intptr_t)cb->code_size(),
-                method_name);
+    print_perf_map_entry(&fs, iter.method());
+  }
+}
+
+// DumpPerfMapOnCompilation support. Callers format their entry into a
+// bounded buffer without holding any lock; PerfMap_lock then only guards
+// copying it into _perf_map_batch. The batch is appended to the map file
+// when it fills up and at exit, so the file is not written and flushed for
+// every installed blob. The stream is opened for appending on first use so
+// that it keeps writing at the end if write_perf_map() rewrites the file.
+static const size_t PerfMapBatchSize = 8 * K;
+static char _perf_map_batch[PerfMapBatchSize];
+static size_t _perf_map_batch_used = 0;
+static fileStream* _perf_map_stream = NULL;
+static bool _perf_map_stream_failed = false;
+
+static void write_perf_map_batch() {
+  assert_lock_strong(PerfMap_lock);
+  if (_perf_map_batch_used == 0) {
+    return;
+  }
+  if (_perf_map_stream == NULL && !_perf_map_stream_failed) {
+    char fname[32];
+    perf_map_file_name(fname, sizeof(fname));
+    fileStream* fs = new (mtCode) fileStream(fname, "a");
+    if (fs->is_open()) {
+      _perf_map_stream = fs;
+    } else {
+      log_warning(codecache)("Failed to open %s for perf map", fname);
+      delete fs;
+      _perf_map_stream_failed = true;
+    }
+  }
+  if (_perf_map_stream != NULL) {
+    _perf_map_stream->write(_perf_map_batch, _perf_map_batch_used);
+    _perf_map_stream->flush();
+  }
+  _perf_map_batch_used = 0;
+}
+
+void CodeCache::write_perf_map_entry(const char* name, address begin, address end) {
+  // Format outside the lock. Overlong names are truncated.
+  char entry[512];
+  jio_snprintf(entry, sizeof(entry) - 1, INTPTR_FORMAT " " INTPTR_FORMAT " %s",
+               (intptr_t)begin, (intptr_t)(end - begin), name);
+  size_t len = strlen(entry);
+  entry[len++] = '\n';
+
+  MutexLocker mu(PerfMap_lock, Mutex::_no_safepoint_check_flag);
+  if (_perf_map_batch_used + len > PerfMapBatchSize) {
+    write_perf_map_batch();
   }
+  memcpy(_perf_map_batch + _perf_map_batch_used, entry, len);
+  _perf_map_batch_used += len;
+}
+
+void CodeCache::write_perf_map_entry(CodeBlob* cb) {
+  ResourceMark rm;
+  const char* method_name =
+    cb->is_compiled() ? cb->as_compiled_method()->method()->external_name()
+                      : cb->name();
+  write_perf_map_entry(method_name, cb->code_begin(), cb->code_end());
+}
+
+void CodeCache::flush_perf_map_entries() {
+  MutexLocker mu(PerfMap_lock, Mutex::_no_safepoint_check_flag);
+  write_perf_map_batch();
 }
 #endif // LINUX
 
@@ -224,6 +224,9 @@ class CodeCache : AllStatic {
   static void print_summary(outputStream* st, bool detailed = true); // Prints a summary of the code cache usage
   static void log_state(outputStream* st);
   LINUX_ONLY(static void write_perf_map();)
+  LINUX_ONLY(static void write_perf_map_entry(CodeBlob* cb);)
+  LINUX_ONLY(static void write_perf_map_entry(const char* name, address begin, address end);)
+  LINUX_ONLY(static void flush_perf_map_entries();)
   static const char* get_code_heap_name(CodeBlobType code_blob_type)  { return (heap_available(code_blob_type) ? get_code_heap(code_blob_type)->name() : "Unused"); }
   static void report_codemem_full(CodeBlobType code_blob_type, bool print);
 
@@ -79,6 +79,7 @@
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/resourceHash.hpp"
 #include "utilities/xmlstream.hpp"
 #if INCLUDE_JVMCI
@@ -530,6 +531,11 @@ nmethod* nmethod::new_native_nmethod(const methodHandle& method,
     debug_only(nm->verify();) // might block
 
     nm->log_new_nmethod();
+#ifdef LINUX
+    if (DumpPerfMapOnCompilation) {
+      CodeCache::write_perf_map_entry(nm);
+    }
+#endif
   }
   return nm;
 }
@@ -629,6 +635,11 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
     // Safepoints in nmethod::verify aren't allowed because nm hasn't been installed yet.
     DEBUG_ONLY(nm->verify();)
     nm->log_new_nmethod();
+#ifdef LINUX
+    if (DumpPerfMapOnCompilation) {
+      CodeCache::write_perf_map_entry(nm);
+    }
+#endif
   }
   return nm;
 }
@@ -1260,7 +1271,21 @@ void nmethod::inc_decompile_count() {
   MethodData* mdo = m->method_data();
   if (mdo == NULL)  return;
   // There is a benign race here.  See comments in methodData.hpp.
-  mdo->inc_decompile_count();
+  uint count = mdo->inc_decompile_count();
+
+  // Repeated deoptimize/recompile cycles are costly but hard to spot in the
+  // per-event output. Report a method each time its count doubles.
+  if (count >= 4 && is_power_of_2(count)) {
+    LogTarget(Info, deoptimization) lt;
+    if (lt.is_enabled()) {
+      ResourceMark rm;
+      LogStream ls(lt);
+      ls.print("Recompilation after deoptimization #%u (cutoff " INTX_FORMAT ") of ",
+               count, PerMethodRecompilationCutoff);
+      m->print_short_name(&ls);
+      ls.cr();
+    }
+  }
 }
 
 bool nmethod::try_transition(int new_state_int) {
@@ -622,9 +622,12 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
+  Thread* current = Thread::current();
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
   // Iterate through the queue and find a method with a maximum rate.
+  // The rates are recomputed on every call (see update_rate()), so the order of
+  // the tasks changes over time and cannot be maintained in a sorted structure.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
     // If a method was unloaded or has been stale for some time, remove it from the queue.
@@ -635,7 +638,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     Method* method = task->method();
-    methodHandle mh(Thread::current(), method);
+    methodHandle mh(current, method);
     if (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, mh) && !is_old(mh)) {
       if (PrintTieredEvents) {
         print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
@@ -646,14 +649,14 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == NULL || compare_methods(method, max_method)) {
+    if (max_task == NULL || compare_tasks(task, max_task)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == NULL || compare_tasks(task, max_blocking_task)) {
         max_blocking_task = task;
       }
     }
@@ -671,7 +674,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     max_method = max_task->method();
   }
 
-  methodHandle max_method_h(Thread::current(), max_method);
+  methodHandle max_method_h(current, max_method);
 
   if (max_task != NULL && max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
       max_method != NULL && is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
@@ -891,6 +894,19 @@ bool CompilationPolicy::compare_methods(Method* x, Method* y) {
   return false;
 }
 
+bool CompilationPolicy::compare_tasks(CompileTask* x, CompileTask* y) {
+  if (PrioritizeOSRCompilations) {
+    // A thread is stuck in the loop of an OSR request until the compilation
+    // is installed, so serve these before standard compilations.
+    bool x_osr = x->osr_bci() != InvocationEntryBci;
+    bool y_osr = y->osr_bci() != InvocationEntryBci;
+    if (x_osr != y_osr) {
+      return x_osr;
+    }
+  }
+  return compare_methods(x->method(), y->method());
+}
+
 // Is method profiled enough?
 bool CompilationPolicy::is_method_profiled(const methodHandle& method) {
   MethodData* mdo = method->method_data();
@@ -205,6 +205,8 @@ class CompilationPolicy : AllStatic {
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
+  // Same as compare_methods(), but may also prefer OSR tasks (see PrioritizeOSRCompilations)
+  inline static bool compare_tasks(CompileTask* x, CompileTask* y);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
@@ -596,6 +596,9 @@ void CompileBroker::compilation_init_phase1(JavaThread* THREAD) {
   if (!UseCompiler) {
     return;
   }
+  // Per-compilation arena memory accounting, see CompilerThread.
+  Arena::set_compiler_size_change_hook(&CompilerThread::arena_size_change_hook);
+
   // Set the interface to the current compiler(s).
   _c1_count = CompilationPolicy::c1_count();
   _c2_count = CompilationPolicy::c2_count();
@@ -2208,6 +2211,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     }
     assert(thread->env() == &ci_env, "set by ci_env");
     // The thread-env() field is cleared in ~CompileTaskWrapper.
+    thread->start_arena_accounting();
 
     // Cache Jvmti state
     bool method_is_old = ci_env.cache_jvmti_state();
@@ -2248,6 +2252,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
     DirectivesStack::release(directive);
 
+    log_debug(jit, compilation)("%d: peak compiler arena usage " SIZE_FORMAT " bytes",
+                                compile_id, thread->arena_bytes_peak());
+
     if (!ci_env.failing() && !task->is_success()) {
       //assert(false, "compiler should always document failure");
       // The compiler elected, without comment, not to register a result.
@@ -2291,6 +2298,14 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  // The start time is set by the ciEnv, so it is not known for JVMCI compilations.
+  if (task->time_started() != 0) {
+    log_debug(jit, compilation)("%d: level %d, queued for %.3fms, compiled in %.3fms",
+                                compile_id, task_level,
+                                TimeHelper::counter_to_millis(task->time_started() - task->time_queued()),
+                                time.seconds() * 1000.0);
+  }
+
   if (PrintCompilation && PrintCompilation2) {
     tty->print("%7d ", (int) tty->time_stamp().milliseconds());  // print timestamp
     tty->print("%4d ", compile_id);    // print compilation number
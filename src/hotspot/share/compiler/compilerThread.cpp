@@ -39,6 +39,10 @@ CompilerThread::CompilerThread(CompileQueue* queue,
   _counters = counters;
   _buffer_blob = NULL;
   _compiler = NULL;
+  _arena_bytes = 0;
+  _arena_bytes_at_start = 0;
+  _arena_bytes_peak = 0;
+  _arena_limit_exceeded = false;
 
   // Compiler uses resource area for compilation, let's bias it to mtCompiler
   resource_area()->bias_to(mtCompiler);
@@ -53,8 +57,30 @@ CompilerThread::~CompilerThread() {
   delete _counters;
 }
 
+void CompilerThread::on_arena_size_change(ssize_t delta) {
+  _arena_bytes += delta;
+  if (_arena_bytes > _arena_bytes_peak) {
+    _arena_bytes_peak = _arena_bytes;
+    if (CompilerArenaMemoryLimit > 0 && arena_bytes_peak() > CompilerArenaMemoryLimit) {
+      // This is called while an arena is growing, so only note the failure
+      // here. The compiler checks it between phases (see check_arena_limit()
+      // in Compile and Compilation) and releases its arenas on the way out.
+      _arena_limit_exceeded = true;
+    }
+  }
+}
+
+void CompilerThread::arena_size_change_hook(ssize_t delta) {
+  Thread* t = Thread::current_or_null();
+  if (t != NULL && t->is_Compiler_thread()) {
+    CompilerThread::cast(t)->on_arena_size_change(delta);
+  }
+}
+
 void CompilerThread::thread_entry(JavaThread* thread, TRAPS) {
   assert(thread->is_Compiler_thread(), "must be compiler thread");
+  // Do not count what the thread allocated while it was being set up.
+  CompilerThread::cast(thread)->start_arena_accounting();
   CompileBroker::compiler_thread_loop();
 }
 
@@ -54,6 +54,14 @@ class CompilerThread : public JavaThread {
   AbstractCompiler*     _compiler;
   TimeStamp             _idle_time;
 
+  // Bytes held by this thread's mtCompiler arenas, in total and at the
+  // start of the current compilation, and the high-water mark since then.
+  ssize_t               _arena_bytes;
+  ssize_t               _arena_bytes_at_start;
+  ssize_t               _arena_bytes_peak;
+  // Set when the peak exceeds CompilerArenaMemoryLimit, see on_arena_size_change()
+  bool                  _arena_limit_exceeded;
+
  public:
 
   static CompilerThread* current() {
@@ -96,6 +104,19 @@ class CompilerThread : public JavaThread {
     _log = log;
   }
 
+  // Per-compilation arena memory accounting
+  void   start_arena_accounting() {
+    _arena_bytes_at_start = _arena_bytes;
+    _arena_bytes_peak = _arena_bytes;
+    _arena_limit_exceeded = false;
+  }
+  size_t arena_bytes_peak() const {
+    return (size_t)(_arena_bytes_peak - _arena_bytes_at_start);
+  }
+  void   on_arena_size_change(ssize_t delta);
+  static void arena_size_change_hook(ssize_t delta); // see Arena::set_compiler_size_change_hook()
+  bool   arena_limit_exceeded() const { return _arena_limit_exceeded; }
+
   void start_idle_timer()                        { _idle_time.update(); }
   jlong idle_time_millis() {
     return TimeHelper::counter_to_millis(_idle_time.ticks_since_update());
@@ -63,6 +63,11 @@
   product(bool, CITime, false,                                              \
           "collect timing information for compilation")                     \
                                                                             \
+  product(size_t, CompilerArenaMemoryLimit, 0, DIAGNOSTIC,                  \
+          "If non-zero, a compilation whose compiler arenas grow by more "  \
+          "than this many bytes is abandoned and the method is marked "     \
+          "not compilable at that tier")                                    \
+                                                                            \
   develop(bool, CITimeVerbose, false,                                       \
           "be more verbose in compilation timings")                         \
                                                                             \
@@ -262,6 +267,9 @@
           "cache is filled by the specified percentage")                    \
           range(0, 99)                                                      \
                                                                             \
+  product(bool, PrioritizeOSRCompilations, false, DIAGNOSTIC,               \
+          "Select queued OSR compilations before standard compilations")    \
+                                                                            \
   product(intx, TieredRateUpdateMinTime, 1,                                 \
           "Minimum rate sampling interval (in milliseconds)")               \
           range(0, max_intx)                                                \
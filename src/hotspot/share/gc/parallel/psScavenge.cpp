@@ -353,6 +353,29 @@ public:
   }
 };
 
+// WorkerPolicy sizes the gang from total heap capacity and application
+// threads, which overestimates the work of a scavenge with a small young gen.
+// The objects to copy are bounded by young gen usage and the old-to-young
+// roots by the used part of old gen that is card scanned, so cap the number
+// of workers by those, using the same HeapSizePerGCThread ratio.
+static uint scavenge_active_workers(PSYoungGen* young_gen, PSOldGen* old_gen) {
+  WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+  uint active_workers = WorkerPolicy::calc_active_workers(workers.max_workers(),
+                                                          workers.active_workers(),
+                                                          Threads::number_of_non_daemon_threads());
+  if (UseDynamicNumberOfGCThreads && FLAG_IS_DEFAULT(ParallelGCThreads)) {
+    size_t work = young_gen->used_in_bytes() + old_gen->used_in_bytes();
+    uint workers_by_work = (uint)MIN2(work / HeapSizePerGCThread, (size_t)workers.max_workers());
+    workers_by_work = MAX2(workers_by_work, MIN2(2u, workers.max_workers()));
+    if (workers_by_work < active_workers) {
+      log_debug(gc, task)("Scavenge: using %u instead of %u workers for " SIZE_FORMAT " used bytes",
+                          workers_by_work, active_workers, work);
+      active_workers = workers_by_work;
+    }
+  }
+  return active_workers;
+}
+
 // This method contains no policy. You should probably
 // be calling invoke() instead.
 bool PSScavenge::invoke_no_policy() {
@@ -443,10 +466,7 @@ bool PSScavenge::invoke_no_policy() {
     // Reset our survivor overflow.
     set_survivor_overflow(false);
 
-    const uint active_workers =
-      WorkerPolicy::calc_active_workers(ParallelScavengeHeap::heap()->workers().max_workers(),
-                                        ParallelScavengeHeap::heap()->workers().active_workers(),
-                                        Threads::number_of_non_daemon_threads());
+    const uint active_workers = scavenge_active_workers(young_gen, old_gen);
     ParallelScavengeHeap::heap()->workers().set_active_workers(active_workers);
 
     PSPromotionManager::pre_scavenge();
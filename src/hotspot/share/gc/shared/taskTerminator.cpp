@@ -73,7 +73,10 @@ TaskTerminator::TaskTerminator(uint n_threads, TaskQueueSetSuper* queue_set) :
   _queue_set(queue_set),
   _offered_termination(0),
   _blocker(Mutex::nosafepoint, "TaskTerminator_lock"),
-  _spin_master(NULL) { }
+  _spin_master(NULL),
+  _offers(0),
+  _failed_offers(0),
+  _sleeps(0) { }
 
 TaskTerminator::~TaskTerminator() {
   if (_offered_termination != 0) {
@@ -81,6 +84,17 @@ TaskTerminator::~TaskTerminator() {
   }
 
   assert(_spin_master == NULL, "Should have been reset");
+  log_and_reset_statistics();
+}
+
+void TaskTerminator::log_and_reset_statistics() {
+  if (_offers != 0) {
+    log_trace(gc, task)("Termination: %u threads, %u offers, %u returned to work, %u sleeps",
+                        _n_threads, _offers, _failed_offers, _sleeps);
+  }
+  _offers = 0;
+  _failed_offers = 0;
+  _sleeps = 0;
 }
 
 #ifdef ASSERT
@@ -95,6 +109,7 @@ void TaskTerminator::reset_for_reuse() {
            "Only %u of %u threads offered termination", _offered_termination, _n_threads);
     assert(_spin_master == NULL, "Leftover spin master " PTR_FORMAT, p2i(_spin_master));
     _offered_termination = 0;
+    log_and_reset_statistics();
   }
 }
 
@@ -144,6 +159,7 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
 
   MonitorLocker x(&_blocker, Mutex::_no_safepoint_check_flag);
   _offered_termination++;
+  _offers++;
 
   if (_offered_termination == _n_threads) {
     prepare_for_return(the_thread);
@@ -175,12 +191,14 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
         } else if (should_exit_termination) {
           prepare_for_return(the_thread, tasks);
           _offered_termination--;
+          _failed_offers++;
           return false;
         }
       }
       // Give up spin master before sleeping.
       _spin_master = NULL;
     }
+    _sleeps++;
     bool timed_out = x.wait(WorkStealingSleepMillis);
 
     // Immediately check exit conditions after re-acquiring the lock.
@@ -192,12 +210,14 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
       // We were woken up. Don't bother waking up more tasks.
       prepare_for_return(the_thread, 0);
       _offered_termination--;
+      _failed_offers++;
       return false;
     } else {
       size_t tasks = tasks_in_queue_set();
       if (exit_termination(tasks, terminator)) {
         prepare_for_return(the_thread, tasks);
         _offered_termination--;
+        _failed_offers++;
         return false;
       }
     }
@@ -79,6 +79,15 @@ class TaskTerminator : public CHeapObj<mtGC> {
   Monitor _blocker;
   Thread* _spin_master;
 
+  // Termination protocol statistics for the current round, protected by
+  // _blocker: offers made, offers that returned to look for more work, and
+  // timed waits on _blocker.
+  uint _offers;
+  uint _failed_offers;
+  uint _sleeps;
+
+  void log_and_reset_statistics();
+
   void assert_queue_set_empty() const NOT_DEBUG_RETURN;
 
   // Prepare for return from offer_termination. Gives up the spin master token
@@ -71,6 +71,9 @@
 #if INCLUDE_JFR
 #include "gc/shenandoah/shenandoahJfrSupport.hpp"
 #endif
+#if INCLUDE_CDS_JAVA_HEAP
+#include "gc/g1/heapRegion.hpp"
+#endif
 
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
@@ -2323,3 +2326,87 @@ bool ShenandoahHeap::requires_barriers(stackChunkOop obj) const {
 
   return false;
 }
+
+HeapWord* ShenandoahHeap::allocate_loaded_archive_space(size_t size) {
+#if INCLUDE_CDS_JAVA_HEAP
+  // CDS wants a contiguous memory range to load a bunch of objects.
+  // This effectively bypasses normal allocation paths, and requires
+  // a bit of massaging to unbreak GC invariants.
+
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_shared(size);
+
+  // Easy case: a single regular region, no further adjustments needed.
+  if (size <= ShenandoahHeapRegion::region_size_words()) {
+    return allocate_memory(req);
+  }
+
+  // Hard case: the requested size would cause a humongous allocation.
+  // We need to make sure it looks like regular allocation to the rest of GC.
+
+  // The archive is written with G1, which guarantees that no object straddles
+  // a boundary of the smallest G1 region size. Shenandoah regions must be at
+  // least that large, otherwise loaded objects could cross region boundaries.
+  if (ShenandoahHeapRegion::region_size_words() < HeapRegion::min_region_size_in_words()) {
+    log_info(cds)("Cannot load archived heap objects: region size " SIZE_FORMAT "K is smaller "
+                  "than the minimum G1 region size " SIZE_FORMAT "K",
+                  ShenandoahHeapRegion::region_size_bytes() / K,
+                  HeapRegion::min_region_size_in_words() * HeapWordSize / K);
+    return NULL;
+  }
+
+  HeapWord* mem = allocate_memory(req);
+  if (mem == NULL) {
+    return NULL;
+  }
+  size_t start_idx = heap_region_index_containing(mem);
+  size_t num_regions = ShenandoahHeapRegion::required_regions(size * HeapWordSize);
+
+  // Flip humongous -> regular.
+  {
+    ShenandoahHeapLocker locker(lock());
+    for (size_t c = start_idx; c < start_idx + num_regions; c++) {
+      get_region(c)->make_regular_bypass();
+    }
+  }
+  log_info(cds)("Archived heap objects span " SIZE_FORMAT " regions", num_regions);
+
+  return mem;
+#else
+  assert(false, "Archive heap loader should not be available, should not be here");
+  return NULL;
+#endif // INCLUDE_CDS_JAVA_HEAP
+}
+
+void ShenandoahHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  // Nothing to do here, except checking that heap looks fine.
+#ifdef ASSERT
+  HeapWord* start = archive_space.start();
+  HeapWord* end = archive_space.end();
+
+  // No unclaimed space between the objects.
+  // Objects are properly allocated in correct regions.
+  HeapWord* cur = start;
+  while (cur < end) {
+    oop obj = cast_to_oop(cur);
+    shenandoah_assert_in_correct_region(NULL, obj);
+    cur += obj->size();
+  }
+
+  // No unclaimed tail at the end of archive space.
+  assert(cur == end,
+         "Archive space should be fully used: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(cur), p2i(end));
+
+  // Region bounds are good.
+  ShenandoahHeapRegion* begin_reg = heap_region_containing(start);
+  ShenandoahHeapRegion* end_reg = heap_region_containing(end);
+  assert(begin_reg->is_regular(), "Must be");
+  assert(end_reg->is_regular(), "Must be");
+  assert(begin_reg->bottom() == start,
+         "Must agree: archive-space-start: " PTR_FORMAT ", begin-region-bottom: " PTR_FORMAT,
+         p2i(start), p2i(begin_reg->bottom()));
+  assert(end_reg->top() == end,
+         "Must agree: archive-space-end: " PTR_FORMAT ", end-region-top: " PTR_FORMAT,
+         p2i(end), p2i(end_reg->top()));
+#endif
+}
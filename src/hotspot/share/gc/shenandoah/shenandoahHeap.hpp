@@ -653,6 +653,13 @@ public:
 private:
   void trash_cset_regions();
 
+// ---------- CDS archive support
+//
+public:
+  bool can_load_archived_objects() const { return UseCompressedOops; }
+  HeapWord* allocate_loaded_archive_space(size_t size);
+  void complete_loaded_archive_space(MemRegion archive_space);
+
 // ---------- Testing helpers functions
 //
 private:
@@ -655,24 +655,30 @@ JRT_END
 //
 
 void InterpreterRuntime::resolve_get_put(JavaThread* current, Bytecodes::Code bytecode) {
-  // resolve field
-  fieldDescriptor info;
   LastFrameAccessor last_frame(current);
   constantPoolHandle pool(current, last_frame.method()->constants());
   methodHandle m(current, last_frame.method());
+
+  resolve_get_put(bytecode, last_frame.get_index_u2_cpcache(bytecode), m, pool, current);
+}
+
+void InterpreterRuntime::resolve_get_put(Bytecodes::Code bytecode, int field_index,
+                                         const methodHandle& m,
+                                         const constantPoolHandle& pool, TRAPS) {
+  // resolve field
+  fieldDescriptor info;
   bool is_put    = (bytecode == Bytecodes::_putfield  || bytecode == Bytecodes::_nofast_putfield ||
                     bytecode == Bytecodes::_putstatic);
   bool is_static = (bytecode == Bytecodes::_getstatic || bytecode == Bytecodes::_putstatic);
 
   {
-    JvmtiHideSingleStepping jhss(current);
-    JavaThread* THREAD = current; // For exception macros.
-    LinkResolver::resolve_field_access(info, pool, last_frame.get_index_u2_cpcache(bytecode),
+    JvmtiHideSingleStepping jhss(THREAD);
+    LinkResolver::resolve_field_access(info, pool, field_index,
                                        m, bytecode, CHECK);
   } // end JvmtiHideSingleStepping
 
   // check if link resolution caused cpCache to be updated
-  ConstantPoolCacheEntry* cp_cache_entry = last_frame.cache_entry();
+  ConstantPoolCacheEntry* cp_cache_entry = pool->cache()->entry_at(ConstantPool::decode_cpcache_index(field_index));
   if (cp_cache_entry->is_resolved(bytecode)) return;
 
   // compute auxiliary field attributes
@@ -852,8 +858,15 @@ void InterpreterRuntime::resolve_invoke(JavaThread* current, Bytecodes::Code byt
     }
   } // end JvmtiHideSingleStepping
 
+  update_invoke_cp_cache_entry(info, bytecode, resolved_method, pool, last_frame.get_index_u2_cpcache(bytecode));
+}
+
+void InterpreterRuntime::update_invoke_cp_cache_entry(CallInfo& info, Bytecodes::Code bytecode,
+                                                      const methodHandle& resolved_method,
+                                                      const constantPoolHandle& pool,
+                                                      int method_index) {
   // check if link resolution caused cpCache to be updated
-  ConstantPoolCacheEntry* cp_cache_entry = last_frame.cache_entry();
+  ConstantPoolCacheEntry* cp_cache_entry = pool->cache()->entry_at(ConstantPool::decode_cpcache_index(method_index));
   if (cp_cache_entry->is_resolved(bytecode)) return;
 
 #ifdef ASSERT
@@ -910,6 +923,50 @@ void InterpreterRuntime::resolve_invoke(JavaThread* current, Bytecodes::Code byt
   }
 }
 
+#if INCLUDE_CDS
+// Resolve an invokevirtual or invokespecial call site at CDS dump time. There is
+// no receiver, so only the link-time resolution and the receiver-independent part
+// of the call info (the resolved method and its vtable index) are computed.
+void InterpreterRuntime::cds_resolve_invoke(Bytecodes::Code bytecode, int method_index,
+                                            const constantPoolHandle& pool, TRAPS) {
+  LinkInfo link_info(pool, method_index, CHECK);
+
+  if (!link_info.resolved_klass()->is_instance_klass()) {
+    // Not supported yet.
+    return;
+  }
+
+  InstanceKlass* resolved_klass = InstanceKlass::cast(link_info.resolved_klass());
+  if (!resolved_klass->is_linked()) {
+    // The vtable of an unlinked class is not set up yet, so leave the
+    // cpCache entry to be resolved at runtime.
+    if (log_is_enabled(Trace, cds, resolve)) {
+      ResourceMark rm(THREAD);
+      log_trace(cds, resolve)("Not resolved: %s %s.%s:%s (class is not linked)",
+                              Bytecodes::name(bytecode), resolved_klass->external_name(),
+                              link_info.name()->as_C_string(),
+                              link_info.signature()->as_C_string());
+    }
+    return;
+  }
+
+  CallInfo call_info;
+  switch (bytecode) {
+  case Bytecodes::_invokevirtual:
+    LinkResolver::cds_resolve_virtual_call(call_info, link_info, CHECK);
+    break;
+  case Bytecodes::_invokespecial:
+    LinkResolver::cds_resolve_special_call(call_info, link_info, CHECK);
+    break;
+  default:
+    fatal("Unimplemented: %s", Bytecodes::name(bytecode));
+  }
+
+  methodHandle resolved_method(THREAD, call_info.resolved_method());
+  guarantee(resolved_method->method_holder()->is_linked(), "must be");
+  update_invoke_cp_cache_entry(call_info, bytecode, resolved_method, pool, method_index);
+}
+#endif // INCLUDE_CDS
 
 // First time execution:  Resolve symbols, create a permanent MethodType object.
 void InterpreterRuntime::resolve_invokehandle(JavaThread* current) {
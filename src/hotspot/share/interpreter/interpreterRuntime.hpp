@@ -91,6 +91,13 @@ class InterpreterRuntime: AllStatic {
   static void    throw_pending_exception(JavaThread* current);
 
   static void resolve_from_cache(JavaThread* current, Bytecodes::Code bytecode);
+
+  // Used by ClassPrelinker to resolve cpCache entries at CDS dump time, when
+  // there is no interpreter frame to take the bytecode and index from.
+  static void resolve_get_put(Bytecodes::Code bytecode, int field_index,
+                              const methodHandle& m, const constantPoolHandle& pool, TRAPS);
+  static void cds_resolve_invoke(Bytecodes::Code bytecode, int method_index,
+                                 const constantPoolHandle& pool, TRAPS);
  private:
   // Statics & fields
   static void resolve_get_put(JavaThread* current, Bytecodes::Code bytecode);
@@ -100,6 +107,10 @@ class InterpreterRuntime: AllStatic {
   static void resolve_invokehandle (JavaThread* current);
   static void resolve_invokedynamic(JavaThread* current);
 
+  static void update_invoke_cp_cache_entry(CallInfo& info, Bytecodes::Code bytecode,
+                                           const methodHandle& resolved_method,
+                                           const constantPoolHandle& pool, int method_index);
+
  public:
   // Synchronization
   static void    monitorenter(JavaThread* current, BasicObjectLock* elem);
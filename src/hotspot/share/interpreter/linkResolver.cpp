@@ -1312,6 +1312,25 @@ void LinkResolver::resolve_virtual_call(CallInfo& result, Handle recv, Klass* re
                                  check_null_and_abstract, CHECK);
 }
 
+#if INCLUDE_CDS
+void LinkResolver::cds_resolve_virtual_call(CallInfo& result, const LinkInfo& link_info, TRAPS) {
+  // There's no receiver at dump time, so the resolved klass stands in for the
+  // receiver klass. The selected method is not used for the cpCache entry,
+  // which only records the resolved method and its vtable index.
+  Method* resolved_method = linktime_resolve_virtual_method(link_info, CHECK);
+  runtime_resolve_virtual_method(result, methodHandle(THREAD, resolved_method),
+                                 link_info.resolved_klass(),
+                                 Handle(), // recv
+                                 link_info.resolved_klass(),
+                                 false, // check_null_and_abstract
+                                 CHECK);
+}
+
+void LinkResolver::cds_resolve_special_call(CallInfo& result, const LinkInfo& link_info, TRAPS) {
+  resolve_special_call(result, Handle(), link_info, CHECK);
+}
+#endif // INCLUDE_CDS
+
 // throws linktime exceptions
 Method* LinkResolver::linktime_resolve_virtual_method(const LinkInfo& link_info,
                                                            TRAPS) {
@@ -316,6 +316,10 @@ class LinkResolver: AllStatic {
   static void resolve_dynamic_call  (CallInfo& result,
                                      BootstrapInfo& bootstrap_specifier, TRAPS);
 
+  // Resolve a call site at CDS dump time, when no receiver is available.
+  static void cds_resolve_virtual_call(CallInfo& result, const LinkInfo& link_info, TRAPS) NOT_CDS_RETURN;
+  static void cds_resolve_special_call(CallInfo& result, const LinkInfo& link_info, TRAPS) NOT_CDS_RETURN;
+
   // same as above for compile-time resolution; but returns null handle instead of throwing
   // an exception on error also, does not initialize klass (i.e., no side effects)
   static Method* resolve_virtual_call_or_null(Klass* receiver_klass,
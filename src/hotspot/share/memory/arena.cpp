@@ -282,6 +282,8 @@ void Arena::destruct_contents() {
   reset();
 }
 
+Arena::SizeChangeHook Arena::_compiler_size_change_hook = NULL;
+
 // This is high traffic method, but many calls actually don't
 // change the size
 void Arena::set_size_in_bytes(size_t size) {
@@ -289,6 +291,9 @@ void Arena::set_size_in_bytes(size_t size) {
     ssize_t delta = size - size_in_bytes();
     _size_in_bytes = size;
     MemTracker::record_arena_size_change(delta, _flags);
+    if (_flags == mtCompiler && _compiler_size_change_hook != NULL) {
+      _compiler_size_change_hook(delta);
+    }
   }
 }
 
@@ -171,7 +171,14 @@ protected:
   size_t size_in_bytes() const         {  return _size_in_bytes; };
   void set_size_in_bytes(size_t size);
 
+  // Hook called with the size change of every mtCompiler arena, used by the
+  // compiler for per-compilation memory accounting (see CompilerThread).
+  typedef void (*SizeChangeHook)(ssize_t delta);
+  static void set_compiler_size_change_hook(SizeChangeHook hook) { _compiler_size_change_hook = hook; }
+
 private:
+  static SizeChangeHook _compiler_size_change_hook;
+
   // Reset this Arena to empty, access will trigger grow if necessary
   void   reset(void) {
     _first = _chunk = NULL;
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/archiveBuilder.hpp"
+#include "cds/classPrelinker.hpp"
 #include "cds/heapShared.hpp"
 #include "classfile/resolutionErrors.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -617,6 +618,21 @@ Method* ConstantPoolCacheEntry::get_interesting_method_entry() {
 }
 #endif // INCLUDE_JVMTI
 
+#if INCLUDE_CDS
+void ConstantPoolCacheEntry::metaspace_pointers_do(MetaspaceClosure* it) {
+  if (is_field_entry()) {
+    it->push((Klass**)&_f1);
+  } else {
+    if (_f1 != NULL) {
+      it->push((Method**)&_f1);
+    }
+    if (is_vfinal()) {
+      it->push((Method**)&_f2);
+    }
+  }
+}
+#endif // INCLUDE_CDS
+
 void ConstantPoolCacheEntry::print(outputStream* st, int index, const ConstantPoolCache* cache) const {
   // print separator
   if (index == 0) st->print_cr("                 -------------");
@@ -731,10 +747,38 @@ void ConstantPoolCache::remove_unshareable_info() {
   // still pointing to the array allocated inside save_for_archive().
   assert(_initial_entries != NULL, "archived cpcache must have been initialized");
   assert(!ArchiveBuilder::current()->is_in_buffer_space(_initial_entries), "must be");
+  ConstantPoolCache* src_cpcache = ArchiveBuilder::current()->get_source_addr(this);
   for (int i=0; i<length(); i++) {
-    // Restore each entry to the initial state -- just after Rewriter::make_constant_pool_cache()
-    // has finished.
-    *entry_at(i) = _initial_entries->at(i);
+    ConstantPoolCacheEntry* src_entry = src_cpcache->entry_at(i);
+    bool archived = ClassPrelinker::can_archive_resolved_cp_cache_entry(src_cpcache, i);
+    if (archived) {
+      // The metadata pointers in this entry have already been relocated by the ArchiveBuilder
+      // (see ConstantPoolCache::metaspace_pointers_do()), so the entry can be kept as is.
+      if (log_is_enabled(Debug, cds, resolve)) {
+        ResourceMark rm;
+        ConstantPool* src_cp = src_cpcache->constant_pool();
+        int cp_index = src_entry->constant_pool_index();
+        log_debug(cds, resolve)("Resolved %s CP entry [%d]: %s => %s.%s:%s",
+                                src_entry->is_field_entry() ? "field" : "method", cp_index,
+                                src_cp->pool_holder()->external_name(),
+                                src_cp->uncached_klass_ref_at_noresolve(cp_index)->as_C_string(),
+                                src_cp->uncached_name_ref_at(cp_index)->as_C_string(),
+                                src_cp->uncached_signature_ref_at(cp_index)->as_C_string());
+      }
+    } else {
+      // Restore each entry to the initial state -- just after Rewriter::make_constant_pool_cache()
+      // has finished.
+      *entry_at(i) = _initial_entries->at(i);
+    }
+
+    if (src_entry->bytecode_1() != Bytecodes::_invokedynamic &&
+        (src_entry->bytecode_1() != 0 || src_entry->bytecode_2() != 0)) {
+      if (src_entry->is_field_entry()) {
+        ArchiveBuilder::alloc_stats()->record_field_cp_entry(archived);
+      } else {
+        ArchiveBuilder::alloc_stats()->record_method_cp_entry(archived);
+      }
+    }
   }
   _initial_entries = NULL;
 }
@@ -825,6 +869,17 @@ void ConstantPoolCache::metaspace_pointers_do(MetaspaceClosure* it) {
   log_trace(cds)("Iter(ConstantPoolCache): %p", this);
   it->push(&_constant_pool);
   it->push(&_reference_map);
+#if INCLUDE_CDS
+  if (_initial_entries != NULL) {
+    // We are dumping this cpCache. The resolved entries that will be kept in the
+    // archive must have their Klass*/Method* pointers relocated.
+    for (int i = 0; i < length(); i++) {
+      if (ClassPrelinker::can_archive_resolved_cp_cache_entry(this, i)) {
+        entry_at(i)->metaspace_pointers_do(it);
+      }
+    }
+  }
+#endif
 }
 
 // Printing
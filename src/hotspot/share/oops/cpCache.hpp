@@ -378,6 +378,12 @@ class ConstantPoolCacheEntry {
   Method* get_interesting_method_entry();
 #endif // INCLUDE_JVMTI
 
+#if INCLUDE_CDS
+  // Push the metadata referenced by a resolved entry that will be stored
+  // in the CDS archive. See ClassPrelinker::can_archive_resolved_cp_cache_entry().
+  void metaspace_pointers_do(MetaspaceClosure* it);
+#endif
+
   // Debugging & Printing
   void print (outputStream* st, int index, const ConstantPoolCache* cache) const;
   void verify(outputStream* st) const;
@@ -902,6 +902,19 @@ bool InstanceKlass::link_class_impl(TRAPS) {
         need_init_table = false;
       }
       if (need_init_table) {
+        if (is_shared() && log_is_enabled(Debug, cds)) {
+          // Report which of the conditions above did not hold.
+          const char* reason;
+          if (!verified_at_dump_time()) {
+            reason = "not verified at dump time";
+          } else if (is_shared_unregistered_class()) {
+            reason = "loaded by a custom class loader";
+          } else {
+            reason = "loader constraints not satisfied";
+          }
+          ResourceMark rm(THREAD);
+          log_debug(cds)("Cannot use archived vtable/itable of %s: %s", external_name(), reason);
+        }
         vtable().initialize_vtable_and_check_constraints(CHECK_false);
         itable().initialize_itable_and_check_constraints(CHECK_false);
       }
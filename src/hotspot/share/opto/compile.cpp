@@ -31,6 +31,7 @@
 #include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerThread.hpp"
 #include "compiler/disassembler.hpp"
 #include "compiler/oopMap.hpp"
 #include "gc/shared/barrierSet.hpp"
@@ -827,6 +828,8 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
   }
 
   // Now optimize
+  check_arena_limit();
+  if (failing())  return;
   Optimize();
   if (failing())  return;
   NOT_PRODUCT( verify_graph_edges(); )
@@ -2866,6 +2869,7 @@ void Compile::optimize_logic_cones(PhaseIterGVN &igvn) {
 //------------------------------Code_Gen---------------------------------------
 // Given a graph, generate code for it
 void Compile::Code_Gen() {
+  check_arena_limit();
   if (failing()) {
     return;
   }
@@ -2966,6 +2970,7 @@ void Compile::Code_Gen() {
     TracePhase tp("output", &timers[_t_output]);
     PhaseOutput output;
     output.Output();
+    check_arena_limit();
     if (failing())  return;
     output.install();
   }
@@ -4311,6 +4316,15 @@ void Compile::record_failure(const char* reason) {
   _root = NULL;  // flush the graph, too
 }
 
+// Fail the compilation if its arenas have grown beyond CompilerArenaMemoryLimit.
+// Called between phases; runtime stubs (no task) are never limited.
+void Compile::check_arena_limit() {
+  if (CompilerArenaMemoryLimit > 0 && env()->task() != NULL && !failing() &&
+      CompilerThread::current()->arena_limit_exceeded()) {
+    record_method_not_compilable("hit memory limit while compiling");
+  }
+}
+
 Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
   : TraceTime(name, accumulator, CITime, CITimeVerbose),
     _phase_name(name), _dolog(CITimeVerbose)
@@ -761,6 +761,7 @@ class Compile : public Phase {
   }
 
   void record_failure(const char* reason);
+  void check_arena_limit();
   void record_method_not_compilable(const char* reason) {
     env()->record_method_not_compilable(reason);
     // Record failure reason.
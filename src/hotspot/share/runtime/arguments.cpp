@@ -3503,9 +3503,13 @@ void Arguments::init_shared_archive_paths() {
       // However, if either RecordDynamicDumpInfo or ArchiveClassesAtExit is used, we do not
       // allow cases (b) and (c). Case (b) is already checked above.
 
+      // Only a single dynamic layer on top of the static archive is supported. A dynamic
+      // archive records the CRCs of exactly one base archive (see DynamicArchive::validate),
+      // so an intermediate layer (e.g. base.jsa:framework.jsa:app.jsa) could not be validated.
       if (archives > 2) {
         vm_exit_during_initialization(
-          "Cannot have more than 2 archive files specified in the -XX:SharedArchiveFile option");
+          "Cannot have more than 2 archive files specified in the -XX:SharedArchiveFile option "
+          "(a dynamic archive can only be layered directly on top of a static archive)", SharedArchiveFile);
       }
       if (archives == 1) {
         char* base_archive_path = NULL;
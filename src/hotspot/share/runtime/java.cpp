@@ -471,6 +471,9 @@ void before_exit(JavaThread* thread, bool halt) {
   }
 
 #ifdef LINUX
+  if (DumpPerfMapOnCompilation) {
+    CodeCache::flush_perf_map_entries();
+  }
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
   }
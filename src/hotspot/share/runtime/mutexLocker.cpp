@@ -133,6 +133,9 @@ Monitor* JfrThreadSampler_lock        = NULL;
 Mutex*   UnsafeJlong_lock             = NULL;
 #endif
 Mutex*   CodeHeapStateAnalytics_lock  = NULL;
+#ifdef LINUX
+Mutex*   PerfMap_lock                 = NULL;
+#endif
 
 Monitor* ContinuationRelativize_lock  = NULL;
 
@@ -315,6 +318,9 @@ void mutex_init() {
 
   def(ContinuationRelativize_lock  , PaddedMonitor, nosafepoint-3);
   def(CodeHeapStateAnalytics_lock  , PaddedMutex  , safepoint);
+#ifdef LINUX
+  def(PerfMap_lock                 , PaddedMutex  , nosafepoint);      // batches DumpPerfMapOnCompilation entries
+#endif
   def(ThreadsSMRDelete_lock        , PaddedMonitor, nosafepoint-3); // Holds ConcurrentHashTableResize_lock
   def(ThreadIdTableCreate_lock     , PaddedMutex  , safepoint);
   def(SharedDecoder_lock           , PaddedMutex  , tty-1);
@@ -145,6 +145,9 @@ extern Mutex*   ClassLoaderDataGraph_lock;       // protects CLDG list, needed f
 
 extern Mutex*   CodeHeapStateAnalytics_lock;     // lock print functions against concurrent analyze functions.
                                                  // Only used locally in PrintCodeCacheLayout processing.
+#ifdef LINUX
+extern Mutex*   PerfMap_lock;                    // protects the DumpPerfMapOnCompilation batch and stream
+#endif
 
 extern Monitor* ContinuationRelativize_lock;
 
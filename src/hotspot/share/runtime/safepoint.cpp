@@ -62,6 +62,7 @@
 #include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/suspendedThreadTask.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
@@ -757,6 +758,54 @@ void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
 }
 
 
+// Samples the pc of a thread that has not reached the safepoint. The thread
+// is suspended while do_task runs and may hold arbitrary locks, so only the
+// pc is recorded here and it is decoded after the thread has been resumed.
+class SafepointStragglerSampler : public SuspendedThreadTask {
+  address _pc;
+ public:
+  SafepointStragglerSampler(JavaThread* thread) : SuspendedThreadTask(thread), _pc(NULL) {}
+
+  virtual void do_task(const SuspendedThreadTaskContext& context) {
+    _pc = os::fetch_frame_from_context(context.ucontext(), NULL, NULL);
+  }
+
+  address pc() const { return _pc; }
+};
+
+// Print where a thread that is keeping the VM from reaching the safepoint is
+// executing, e.g. a long counted loop in compiled code.
+static void print_straggler_location(outputStream* st, JavaThread* thread) {
+  SafepointStragglerSampler sampler(thread);
+  sampler.run();
+  address pc = sampler.pc();
+  if (pc == NULL) {
+    return;
+  }
+  st->print("#   pc " PTR_FORMAT " ", p2i(pc));
+  if (Interpreter::contains(pc)) {
+    st->print_cr("in the interpreter");
+    return;
+  }
+  CodeBlob* cb = CodeCache::find_blob(pc);
+  if (cb == NULL) {
+    st->print_cr("outside the code cache");
+    return;
+  }
+  if (cb->is_compiled()) {
+    CompiledMethod* cm = cb->as_compiled_method();
+    PcDesc* pd = cm->pc_desc_near(pc);
+    if (pd != NULL) {
+      ScopeDesc* sd = new ScopeDesc(cm, pd);
+      st->print("in ");
+      sd->method()->print_short_name(st);
+      st->print_cr(" @ bci %d (%s)", sd->bci(), cm->compiler_name());
+      return;
+    }
+  }
+  st->print_cr("in %s", cb->name());
+}
+
 void SafepointSynchronize::print_safepoint_timeout() {
   if (!timeout_error_printed) {
     timeout_error_printed = true;
@@ -776,6 +825,7 @@ void SafepointSynchronize::print_safepoint_timeout() {
           ls.print("# ");
           cur_thread->print_on(&ls);
           ls.cr();
+          print_straggler_location(&ls, cur_thread);
         }
       }
       ls.print_cr("# SafepointSynchronize::begin: (End of list)");
@@ -2732,7 +2732,8 @@ BufferBlob* AdapterHandlerLibrary::buffer_blob() {
 
 static void post_adapter_creation(const AdapterBlob* new_adapter,
                                   const AdapterHandlerEntry* entry) {
-  if (Forte::is_enabled() || JvmtiExport::should_post_dynamic_code_generated()) {
+  if (Forte::is_enabled() || LINUX_ONLY(DumpPerfMapOnCompilation ||)
+      JvmtiExport::should_post_dynamic_code_generated()) {
     char blob_id[256];
     jio_snprintf(blob_id,
                  sizeof(blob_id),
@@ -2742,6 +2743,11 @@ static void post_adapter_creation(const AdapterBlob* new_adapter,
     if (Forte::is_enabled()) {
       Forte::register_stub(blob_id, new_adapter->content_begin(), new_adapter->content_end());
     }
+#ifdef LINUX
+    if (DumpPerfMapOnCompilation) {
+      CodeCache::write_perf_map_entry(blob_id, new_adapter->content_begin(), new_adapter->content_end());
+    }
+#endif
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       JvmtiExport::post_dynamic_code_generated(blob_id, new_adapter->content_begin(), new_adapter->content_end());
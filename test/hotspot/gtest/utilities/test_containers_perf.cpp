@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "memory/arena.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+#include "utilities/ticks.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// These "tests" don't really verify much.  Rather, they are mostly
+// microbenchmarks for VM-internal containers.  Each one performs a fixed
+// number of operations and prints the elapsed time, so a change to one of
+// the containers can be compared against a run of the unchanged code.
+// They are disabled by default; run them with
+//   --gtest_also_run_disabled_tests --gtest_filter=ContainersPerf.*
+
+const uintptr_t _perf_entries = 100000;
+
+static void print_perf(const char* what, Tickspan duration, uintptr_t ops = _perf_entries) {
+  tty->print_cr("%s: " UINTX_FORMAT " operations in " UINT64_FORMAT " ns (%.1f ns/op)",
+                what, (uintx)ops, duration.nanoseconds(),
+                (double)duration.nanoseconds() / ops);
+}
+
+TEST_VM(ContainersPerf, DISABLED_resource_hashtable) {
+  typedef ResourceHashtable<uintptr_t, uintptr_t, 1009, AnyObj::C_HEAP, mtTest> Table;
+  Table* table = new (mtTest) Table();
+
+  Ticks start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    table->put(i, i);
+  }
+  print_perf("ResourceHashtable put", Ticks::now() - start);
+
+  uintptr_t sum = 0;
+  start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    sum += *table->get(i);
+  }
+  print_perf("ResourceHashtable get", Ticks::now() - start);
+
+  EXPECT_EQ(sum, _perf_entries * (_perf_entries - 1) / 2);
+  delete table;
+}
+
+struct PerfConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)value;
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return os::malloc(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    os::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<PerfConfig, mtTest> PerfTable;
+
+struct PerfLookup {
+  uintptr_t _val;
+  PerfLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return PerfConfig::get_hash(_val, NULL);
+  }
+  bool equals(const uintptr_t* value, bool* is_dead) {
+    return _val == *value;
+  }
+};
+
+struct PerfGet {
+  uintptr_t _value;
+  PerfGet() : _value(0) {}
+  void operator()(uintptr_t* value) {
+    _value = *value;
+  }
+};
+
+TEST_VM(ContainersPerf, DISABLED_concurrent_hashtable) {
+  Thread* thread = Thread::current();
+  // Sized up front so the timings do not include growing the table.
+  PerfTable* table = new PerfTable(17 /* log2size */);
+
+  Ticks start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    PerfLookup lookup(i);
+    table->insert(thread, lookup, i);
+  }
+  print_perf("ConcurrentHashTable insert", Ticks::now() - start);
+
+  uintptr_t sum = 0;
+  start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    PerfLookup lookup(i);
+    PerfGet get;
+    table->get(thread, lookup, get);
+    sum += get._value;
+  }
+  print_perf("ConcurrentHashTable get", Ticks::now() - start);
+
+  EXPECT_EQ(sum, _perf_entries * (_perf_entries - 1) / 2);
+  delete table;
+}
+
+// Concurrent lookups in a shared table, with an increasing number of threads.
+// Each thread performs _perf_entries lookups, so the ns/op reported is the
+// wall time divided by the total number of lookups of all threads.
+TEST_VM(ContainersPerf, DISABLED_concurrent_hashtable_mt) {
+  Thread* thread = Thread::current();
+  PerfTable* table = new PerfTable(17 /* log2size */);
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    PerfLookup lookup(i);
+    table->insert(thread, lookup, i);
+  }
+
+  volatile uintptr_t sum = 0;
+  auto reader = [&](Thread* current, int id) {
+    uintptr_t local_sum = 0;
+    for (uintptr_t i = 0; i < _perf_entries; i++) {
+      PerfLookup lookup(i);
+      PerfGet get;
+      table->get(current, lookup, get);
+      local_sum += get._value;
+    }
+    Atomic::add(&sum, local_sum);
+  };
+
+  for (int nthreads = 1; nthreads <= 8; nthreads *= 2) {
+    sum = 0;
+    TestThreadGroup<decltype(reader)> ttg(reader, nthreads);
+    Ticks start = Ticks::now();
+    ttg.doit();
+    ttg.join();
+    Tickspan duration = Ticks::now() - start;
+
+    char what[64];
+    os::snprintf(what, sizeof(what), "ConcurrentHashTable get, %d threads", nthreads);
+    print_perf(what, duration, _perf_entries * nthreads);
+    EXPECT_EQ(Atomic::load(&sum), nthreads * (_perf_entries * (_perf_entries - 1) / 2));
+  }
+  delete table;
+}
+
+// There is no way to build a CompactHashtable outside of a CDS dump, so
+// measure it through the archived part of the SymbolTable, which is where
+// the vmSymbols are found when the CDS archive is mapped.
+TEST_VM(ContainersPerf, DISABLED_compact_hashtable) {
+  if (!UseSharedSpaces || !vmSymbols::symbol_at(vmSymbolID::FIRST_SID)->is_shared()) {
+    tty->print_cr("CDS archive is not mapped, skipping CompactHashtable lookups");
+    return;
+  }
+
+  uintptr_t lookups = 0;
+  uintptr_t found = 0;
+  Ticks start = Ticks::now();
+  while (lookups < _perf_entries) {
+    for (auto index : EnumRange<vmSymbolID>{}) {
+      Symbol* sym = vmSymbols::symbol_at(index);
+      if (SymbolTable::probe((const char*)sym->base(), sym->utf8_length()) == sym) {
+        found++;
+      }
+      lookups++;
+    }
+  }
+  print_perf("SymbolTable probe of archived symbols", Ticks::now() - start, lookups);
+
+  EXPECT_EQ(found, lookups);
+}
+
+TEST_VM(ContainersPerf, DISABLED_growable_array) {
+  GrowableArrayCHeap<uintptr_t, mtTest> array;
+
+  Ticks start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    array.append(i);
+  }
+  print_perf("GrowableArray append", Ticks::now() - start);
+
+  uintptr_t sum = 0;
+  start = Ticks::now();
+  for (int i = 0; i < array.length(); i++) {
+    sum += array.at(i);
+  }
+  print_perf("GrowableArray at", Ticks::now() - start);
+
+  EXPECT_EQ(sum, _perf_entries * (_perf_entries - 1) / 2);
+}
+
+TEST_VM(ContainersPerf, DISABLED_arena) {
+  Arena arena(mtTest);
+
+  Ticks start = Ticks::now();
+  for (uintptr_t i = 0; i < _perf_entries; i++) {
+    // Mix of small sizes, as typical for compiler and resource area use.
+    void* p = arena.Amalloc(16 + (i % 8) * 8);
+    ASSERT_NE(p, (void*)NULL);
+  }
+  print_perf("Arena Amalloc", Ticks::now() - start);
+}
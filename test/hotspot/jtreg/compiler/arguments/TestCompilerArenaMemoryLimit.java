@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=c1
+ * @summary A C1 compilation that exceeds CompilerArenaMemoryLimit bails out and the VM keeps running
+ * @requires vm.flagless
+ * @requires vm.compiler1.enabled
+ * @library /test/lib
+ * @run driver compiler.arguments.TestCompilerArenaMemoryLimit c1
+ */
+
+/*
+ * @test id=c2
+ * @summary A C2 compilation that exceeds CompilerArenaMemoryLimit bails out and the VM keeps running
+ * @requires vm.flagless
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.arguments.TestCompilerArenaMemoryLimit c2
+ */
+
+package compiler.arguments;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompilerArenaMemoryLimit {
+
+    public static void main(String[] args) throws Exception {
+        String compilerFlag = args[0].equals("c1") ? "-XX:TieredStopAtLevel=1" : "-XX:-TieredCompilation";
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            // Any growth of the compiler arenas exceeds a limit of one byte.
+            "-XX:CompilerArenaMemoryLimit=1",
+            compilerFlag,
+            "-Xbatch",
+            "-XX:+PrintCompilation",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + Test.class.getName() + "::test",
+            Test.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("COMPILE SKIPPED: hit memory limit while compiling");
+        output.shouldContain(Test.DONE);
+    }
+
+    static class Test {
+        static final String DONE = "Test finished";
+
+        static int test(int i) {
+            return i * 31 + (i >>> 3);
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 50_000; i++) {
+                sum += test(i);
+            }
+            System.out.println(DONE + " " + sum);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Load archived heap objects with Shenandoah, in several regions and
+ *          with regions that are too small
+ * @requires vm.gc.Shenandoah
+ * @requires vm.cds.write.archived.java.heap
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver gc.shenandoah.TestArchivedHeapLoading
+ */
+
+package gc.shenandoah;
+
+import java.io.File;
+import java.io.PrintWriter;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestArchivedHeapLoading {
+
+    static final String ARCHIVE = "TestArchivedHeapLoading.jsa";
+    static final String CONFIG = "TestArchivedHeapLoading.txt";
+
+    // About 2.5M of extra archived strings, so the archived heap objects
+    // do not fit in a single 1M region.
+    static final int EXTRA_STRINGS = 10_000;
+
+    public static void main(String[] args) throws Exception {
+        writeConfig();
+
+        // The archived heap objects are written with G1.
+        OutputAnalyzer dump = run("-Xshare:dump",
+                                  "-XX:SharedArchiveFile=" + ARCHIVE,
+                                  "-XX:SharedArchiveConfigFile=" + CONFIG,
+                                  "-XX:+UseG1GC",
+                                  "-Xmx128m",
+                                  "-version");
+        dump.shouldHaveExitValue(0);
+
+        // 1M is the minimum G1 region size, so the objects can be loaded into
+        // several Shenandoah regions.
+        OutputAnalyzer out = load("1M");
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Archived heap objects span");
+        out.shouldContain("Loaded heap    region");
+        out.shouldNotContain("Cannot load archived heap objects");
+        out.shouldContain(Test.DONE);
+
+        // Objects could straddle regions smaller than the minimum G1 region
+        // size, so they are not loaded, but the VM still runs.
+        out = load("256K");
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Cannot load archived heap objects: region size 256K");
+        out.shouldNotContain("Loaded heap    region");
+        out.shouldContain(Test.DONE);
+    }
+
+    static void writeConfig() throws Exception {
+        try (PrintWriter pw = new PrintWriter(new File(CONFIG))) {
+            pw.println("VERSION: 1.0");
+            pw.println("@SECTION: String");
+            for (int i = 0; i < EXTRA_STRINGS; i++) {
+                String s = String.format("TestArchivedHeapLoading-%06d-", i) + "x".repeat(100);
+                pw.println(s.length() + ": " + s);
+            }
+        }
+    }
+
+    static OutputAnalyzer load(String regionSize) throws Exception {
+        return run("-Xshare:on",
+                   "-XX:SharedArchiveFile=" + ARCHIVE,
+                   "-XX:+UseShenandoahGC",
+                   "-XX:+UnlockExperimentalVMOptions",
+                   "-XX:ShenandoahRegionSize=" + regionSize,
+                   "-XX:+UnlockDiagnosticVMOptions",
+                   "-XX:+ShenandoahVerify",
+                   "-Xmx128m",
+                   "-Xlog:cds",
+                   Test.class.getName());
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getOutput());
+        return output;
+    }
+
+    static class Test {
+        static final String DONE = "Test finished";
+
+        public static void main(String[] args) {
+            // Archived strings are reachable from the string table, and the
+            // verifier checks them when the heap is collected.
+            String s = String.format("TestArchivedHeapLoading-%06d-", 42) + "x".repeat(100);
+            if (s.intern() != s.intern()) {
+                throw new RuntimeException("intern() is not stable");
+            }
+            System.gc();
+            System.out.println(DONE);
+        }
+    }
+}